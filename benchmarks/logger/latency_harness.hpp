@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <demiplane/chrono>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "benchmark_harness.hpp"
+
+namespace bench {
+
+    /**
+     * @brief Per-call latency percentiles in nanoseconds
+     */
+    struct LatencySummary {
+        double p50_ns  = 0.0;
+        double p99_ns  = 0.0;
+        double p999_ns = 0.0;
+        double max_ns  = 0.0;
+    };
+
+    /**
+     * @brief Percentiles of @p samples (sorted in place), scaled by @p ns_per_sample
+     */
+    inline LatencySummary summarize_latency(std::vector<std::uint64_t>& samples, const double ns_per_sample) {
+        if (samples.empty()) {
+            return {};
+        }
+        std::ranges::sort(samples);
+        const auto at = [&](const double quantile) {
+            const auto index = static_cast<std::size_t>(quantile * static_cast<double>(samples.size() - 1));
+            return static_cast<double>(samples[index]) * ns_per_sample;
+        };
+        return LatencySummary{
+            .p50_ns  = at(0.50),
+            .p99_ns  = at(0.99),
+            .p999_ns = at(0.999),
+            .max_ns  = static_cast<double>(samples.back()) * ns_per_sample,
+        };
+    }
+
+    struct LatencyResult {
+        BenchmarkResult run;
+        LatencySummary latency;
+    };
+
+    /**
+     * @brief Producer-side latency: every call is timed with two TscClock reads
+     *
+     * Threads start together on a barrier; samples are raw counter ticks kept in
+     * per-thread preallocated vectors, converted once at the end. Reading the
+     * counter costs a few nanoseconds — far below steady_clock::now().
+     */
+    template <typename LogFn>
+    LatencyResult run_latency_benchmark(const std::size_t thread_count, const std::size_t iterations, LogFn&& log_fn) {
+        using demiplane::chrono::TscClock;
+
+        std::barrier start_line{static_cast<std::ptrdiff_t>(thread_count + 1)};
+        std::vector<std::vector<std::uint64_t>> samples(thread_count, std::vector<std::uint64_t>(iterations));
+        std::vector<ThreadResult> thread_results(thread_count);
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&, id = i] {
+                auto& own = samples[id];
+                start_line.arrive_and_wait();
+                const auto thread_start = std::chrono::steady_clock::now();
+
+                for (std::size_t j = 0; j < iterations; ++j) {
+                    const std::uint64_t before = TscClock::ticks();
+                    log_fn();
+                    own[j] = TscClock::ticks() - before;
+                }
+
+                thread_results[id].completion_time = std::chrono::steady_clock::now() - thread_start;
+            });
+        }
+
+        start_line.arrive_and_wait();
+        const auto wall_start = std::chrono::steady_clock::now();
+        for (auto& t : threads) {
+            t.join();
+        }
+        const auto wall_clock = std::chrono::steady_clock::now() - wall_start;
+
+        std::vector<std::uint64_t> merged;
+        merged.reserve(thread_count * iterations);
+        for (auto& own : samples) {
+            merged.insert(merged.end(), own.begin(), own.end());
+            std::vector<std::uint64_t>{}.swap(own);
+        }
+
+        const double wall_sec = std::chrono::duration<double>(wall_clock).count();
+        return LatencyResult{
+            .run =
+                BenchmarkResult{
+                    .thread_count       = thread_count,
+                    .iterations         = iterations,
+                    .thread_results     = std::move(thread_results),
+                    .wall_clock         = std::chrono::duration_cast<std::chrono::nanoseconds>(wall_clock),
+                    .entries_per_second = static_cast<double>(thread_count * iterations) / wall_sec,
+                },
+            .latency = summarize_latency(merged, TscClock::calibration().ns_per_tick()),
+        };
+    }
+
+    struct SustainedResult {
+        double entries_per_second = 0.0;
+        std::uint64_t calls       = 0;
+        std::uint64_t stalls      = 0;  // calls slower than the stall threshold — producers hit back-pressure
+        LatencySummary latency;
+    };
+
+    /**
+     * @brief Log flat out from @p thread_count threads for @p duration
+     *
+     * Once sinks fall behind, the ring fills and calls start to wait; the stall
+     * count and the latency tail show when and how hard that happens.
+     */
+    template <typename LogFn>
+    SustainedResult run_sustained_benchmark(const std::size_t thread_count,
+                                            const std::chrono::nanoseconds duration,
+                                            const std::chrono::nanoseconds stall_threshold,
+                                            LogFn&& log_fn) {
+        using demiplane::chrono::TscClock;
+
+        const double ns_per_tick = TscClock::calibration().ns_per_tick();
+        const auto stall_ticks =
+            static_cast<std::uint64_t>(static_cast<double>(stall_threshold.count()) / ns_per_tick);
+        constexpr std::size_t keep = 1 << 16;  // latest samples kept per thread for percentiles
+
+        std::atomic<bool> stop{false};
+        std::barrier start_line{static_cast<std::ptrdiff_t>(thread_count + 1)};
+        std::vector<std::vector<std::uint64_t>> samples(thread_count);
+        std::vector<std::uint64_t> calls(thread_count, 0);
+        std::vector<std::uint64_t> stalls(thread_count, 0);
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&, id = i] {
+                auto& own = samples[id];
+                own.reserve(keep);
+                std::uint64_t own_calls = 0, own_stalls = 0;
+                start_line.arrive_and_wait();
+
+                while (!stop.load(std::memory_order_relaxed)) {
+                    const std::uint64_t before = TscClock::ticks();
+                    log_fn();
+                    const std::uint64_t elapsed = TscClock::ticks() - before;
+                    own_stalls += elapsed > stall_ticks;
+                    if (own.size() < keep) {
+                        own.push_back(elapsed);
+                    } else {
+                        own[own_calls % keep] = elapsed;
+                    }
+                    ++own_calls;
+                }
+                calls[id]  = own_calls;
+                stalls[id] = own_stalls;
+            });
+        }
+
+        start_line.arrive_and_wait();
+        const auto wall_start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(duration);
+        stop.store(true, std::memory_order_relaxed);
+        for (auto& t : threads) {
+            t.join();
+        }
+        const double wall_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+
+        SustainedResult result;
+        std::vector<std::uint64_t> merged;
+        for (std::size_t i = 0; i < thread_count; ++i) {
+            result.calls  += calls[i];
+            result.stalls += stalls[i];
+            merged.insert(merged.end(), samples[i].begin(), samples[i].end());
+        }
+        result.entries_per_second = static_cast<double>(result.calls) / wall_sec;
+        result.latency            = summarize_latency(merged, ns_per_tick);
+        return result;
+    }
+
+    /**
+     * @brief Command line shared by the logger suite executables
+     *
+     *   --threads 1,8,64     producer thread counts
+     *   --sizes 16,256,4096  message payload sizes in bytes
+     *   --iterations N       calls per thread per run
+     *   --sustain-seconds S  duration of each sustained-throughput run
+     *   --json PATH          write results as JSON (for tracking across commits)
+     *   --commit SHA         recorded in the JSON report
+     *   --quick              smoke-test sized matrix
+     */
+    struct SuiteOptions {
+        std::vector<std::size_t> threads       = {1, 2, 4, 8, 16, 32, 64};
+        std::vector<std::size_t> sink_threads  = {1, 8};
+        std::vector<std::size_t> message_sizes = {16, 256, 4096};
+        std::size_t iterations                 = 100'000;
+        std::chrono::seconds sustain{5};
+        std::string json_path;
+        std::string commit;
+    };
+
+    inline std::vector<std::size_t> parse_list(const std::string_view text) {
+        std::vector<std::size_t> values;
+        for (std::size_t pos = 0; pos < text.size();) {
+            const std::size_t end = std::min(text.find(',', pos), text.size());
+            std::size_t value     = 0;
+            if (std::from_chars(text.data() + pos, text.data() + end, value).ec == std::errc{} && value != 0) {
+                values.push_back(value);
+            }
+            pos = end + 1;
+        }
+        return values;
+    }
+
+    inline SuiteOptions parse_suite_options(const int argc, char** argv) {
+        SuiteOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            const auto next            = [&]() -> std::string_view { return i + 1 < argc ? argv[++i] : ""; };
+            if (arg == "--threads") {
+                options.threads = parse_list(next());
+            } else if (arg == "--sizes") {
+                options.message_sizes = parse_list(next());
+            } else if (arg == "--iterations") {
+                const auto values  = parse_list(next());
+                options.iterations = values.empty() ? options.iterations : values[0];
+            } else if (arg == "--sustain-seconds") {
+                const auto values = parse_list(next());
+                options.sustain   = std::chrono::seconds{values.empty() ? options.sustain.count() : values[0]};
+            } else if (arg == "--json") {
+                options.json_path = next();
+            } else if (arg == "--commit") {
+                options.commit = next();
+            } else if (arg == "--quick") {
+                options.threads       = {1, 4};
+                options.sink_threads  = {1, 4};
+                options.message_sizes = {256};
+                options.iterations    = 10'000;
+                options.sustain       = std::chrono::seconds{1};
+            } else {
+                std::cerr << "unknown option: " << arg << '\n';
+            }
+        }
+        return options;
+    }
+
+    /**
+     * @brief One measured configuration
+     */
+    struct Record {
+        std::string library;
+        std::string scenario;  // producer_latency / end_to_end / sustained
+        std::string wait_strategy;
+        std::string sink;
+        std::size_t threads       = 0;
+        std::size_t message_size  = 0;
+        double entries_per_second = 0.0;
+        LatencySummary latency;
+        std::uint64_t stalls = 0;
+    };
+
+    /**
+     * @brief Results collected over a suite run, rendered as one JSON document
+     *
+     *   {"library":"scroll","commit":"…","timestamp":…,"results":[{…}, …]}
+     *
+     * Records are flat, so two reports diff cleanly and load straight into a dataframe.
+     */
+    class JsonReport {
+    public:
+        JsonReport(std::string library, std::string commit)
+            : library_{std::move(library)},
+              commit_{std::move(commit)} {
+        }
+
+        void add(Record record) {
+            record.library = library_;
+            print(record);
+            records_.push_back(std::move(record));
+        }
+
+        [[nodiscard]] std::string render() const {
+            std::string out = std::format(R"({{"library":"{}","commit":"{}","timestamp":{},"results":[)",
+                                          library_,
+                                          commit_,
+                                          static_cast<long long>(std::time(nullptr)));
+            for (std::size_t i = 0; i < records_.size(); ++i) {
+                const auto& r = records_[i];
+                std::format_to(std::back_inserter(out),
+                               R"({}{{"scenario":"{}","wait_strategy":"{}","sink":"{}","threads":{},)"
+                               R"("message_size":{},"ops_per_sec":{:.0f},"stalls":{},)"
+                               R"("latency_ns":{{"p50":{:.1f},"p99":{:.1f},"p999":{:.1f},"max":{:.1f}}}}})",
+                               i == 0 ? "" : ",",
+                               r.scenario,
+                               r.wait_strategy,
+                               r.sink,
+                               r.threads,
+                               r.message_size,
+                               r.entries_per_second,
+                               r.stalls,
+                               r.latency.p50_ns,
+                               r.latency.p99_ns,
+                               r.latency.p999_ns,
+                               r.latency.max_ns);
+            }
+            out.append("]}\n");
+            return out;
+        }
+
+        /// Write to @p path; no-op for an empty path
+        void write(const std::string& path) const {
+            if (path.empty()) {
+                return;
+            }
+            std::ofstream file{path, std::ios::out | std::ios::trunc};
+            file << render();
+            std::cout << "\nResults written to " << path << '\n';
+        }
+
+    private:
+        std::string library_;
+        std::string commit_;
+        std::vector<Record> records_;
+
+        static void print(const Record& r) {
+            std::cout << std::format("{:<8} {:<16} {:<9} {:<10} t={:<3} size={:<5} {:>12.0f} ops/s  "
+                                     "p50={:>8.1f} p99={:>9.1f} p99.9={:>10.1f} max={:>11.1f} ns",
+                                     r.library,
+                                     r.scenario,
+                                     r.wait_strategy,
+                                     r.sink,
+                                     r.threads,
+                                     r.message_size,
+                                     r.entries_per_second,
+                                     r.latency.p50_ns,
+                                     r.latency.p99_ns,
+                                     r.latency.p999_ns,
+                                     r.latency.max_ns);
+            if (r.stalls != 0) {
+                std::cout << std::format("  stalls={}", r.stalls);
+            }
+            std::cout << '\n';
+        }
+    };
+
+    inline std::string make_payload(const std::size_t size) {
+        return std::string(size, 'x');
+    }
+
+}  // namespace bench
@@ -0,0 +1,116 @@
+#include <filesystem>
+
+#include <quill/Backend.h>
+#include <quill/Frontend.h>
+#include <quill/LogMacros.h>
+#include <quill/Logger.h>
+#include <quill/sinks/FileSink.h>
+#include <quill/sinks/NullSink.h>
+
+#include "latency_harness.hpp"
+
+namespace {
+    const std::filesystem::path bench_dir = "quill_suite_logs";
+
+    quill::Logger* make_logger(const std::string_view kind) {
+        std::filesystem::remove_all(bench_dir);
+        std::filesystem::create_directories(bench_dir);
+
+        static int generation = 0;
+        const auto name       = std::format("bench_{}", generation++);
+        if (kind == "file") {
+            auto sink = quill::Frontend::create_or_get_sink<quill::FileSink>(
+                (bench_dir / std::format("{}.log", name)).string(),
+                [] {
+                    quill::FileSinkConfig cfg;
+                    cfg.set_open_mode('w');
+                    return cfg;
+                }(),
+                quill::FileEventNotifier{});
+            return quill::Frontend::create_or_get_logger(name, std::move(sink));
+        }
+        return quill::Frontend::create_or_get_logger(name, quill::Frontend::create_or_get_sink<quill::NullSink>(name));
+    }
+
+    void finish(quill::Logger* logger) {
+        logger->flush_log();
+        quill::Frontend::remove_logger(logger);
+    }
+}  // namespace
+
+int main(const int argc, char** argv) {
+    const auto options = bench::parse_suite_options(argc, argv);
+    bench::JsonReport report{"quill", options.commit};
+
+    quill::Backend::start();
+    std::cout << "Quill Benchmark Suite\n";
+
+    for (const std::size_t threads : options.threads) {
+        for (const std::size_t size : options.message_sizes) {
+            const auto payload = bench::make_payload(size);
+            auto* logger       = make_logger("null");
+
+            const auto result = bench::run_latency_benchmark(
+                threads, options.iterations, [&] { LOG_INFO(logger, "{}", payload); });
+            finish(logger);
+
+            report.add(bench::Record{
+                .scenario           = "producer_latency",
+                .wait_strategy      = "n/a",
+                .sink               = "null",
+                .threads            = threads,
+                .message_size       = size,
+                .entries_per_second = result.run.entries_per_second,
+                .latency            = result.latency,
+            });
+        }
+    }
+
+    for (const std::size_t threads : options.sink_threads) {
+        for (const std::size_t size : options.message_sizes) {
+            const auto payload = bench::make_payload(size);
+            auto* logger       = make_logger("file");
+
+            const auto start  = std::chrono::steady_clock::now();
+            const auto result = bench::run_latency_benchmark(
+                threads, options.iterations, [&] { LOG_INFO(logger, "{}", payload); });
+            finish(logger);
+            const double drained_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            report.add(bench::Record{
+                .scenario           = "sink",
+                .wait_strategy      = "n/a",
+                .sink               = "file",
+                .threads            = threads,
+                .message_size       = size,
+                .entries_per_second = static_cast<double>(threads * options.iterations) / drained_sec,
+                .latency            = result.latency,
+            });
+        }
+    }
+
+    for (const std::size_t threads : options.sink_threads) {
+        const auto payload = bench::make_payload(256);
+        auto* logger       = make_logger("file");
+
+        const auto result = bench::run_sustained_benchmark(
+            threads, options.sustain, std::chrono::microseconds{100}, [&] { LOG_INFO(logger, "{}", payload); });
+        finish(logger);
+
+        report.add(bench::Record{
+            .scenario           = "sustained",
+            .wait_strategy      = "n/a",
+            .sink               = "file",
+            .threads            = threads,
+            .message_size       = payload.size(),
+            .entries_per_second = result.entries_per_second,
+            .latency            = result.latency,
+            .stalls             = result.stalls,
+        });
+    }
+
+    quill::Backend::stop();
+    std::filesystem::remove_all(bench_dir);
+    report.write(options.json_path);
+    return 0;
+}
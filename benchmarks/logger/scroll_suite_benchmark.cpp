@@ -0,0 +1,282 @@
+#include <demiplane/scroll>
+#include <filesystem>
+#include <mutex>
+#include <source_location>
+#include <streambuf>
+
+#include "latency_harness.hpp"
+
+namespace {
+    using namespace demiplane::scroll;
+
+    class NullSink final : public Sink {
+    public:
+        void process(const LogEvent& /*event*/) override {
+        }
+        void flush() override {
+        }
+        [[nodiscard]] bool should_log(LogLevel /*lvl*/, std::string_view /*prefix*/) const noexcept override {
+            return true;
+        }
+    };
+
+    /// Discards everything written to it — lets StructuredSink run its encoder without I/O
+    class NullBuffer final : public std::streambuf {
+    protected:
+        std::streamsize xsputn(const char* /*s*/, const std::streamsize count) override {
+            return count;
+        }
+        int_type overflow(const int_type ch) override {
+            return traits_type::not_eof(ch);
+        }
+    };
+
+    /**
+     * @brief Wraps a sink and records, per event, the time from the log call until the
+     *        wrapped sink has written and flushed it (i.e. handed it to the kernel)
+     */
+    class LatencyProbeSink final : public Sink {
+    public:
+        explicit LatencyProbeSink(std::shared_ptr<Sink> inner, const std::size_t expected)
+            : inner_{std::move(inner)} {
+            samples_.reserve(expected);
+        }
+
+        void process(const LogEvent& event) override {
+            process_batch(std::span{&event, 1});
+        }
+
+        void process_batch(const std::span<const LogEvent> batch) override {
+            inner_->process_batch(batch);
+            inner_->flush();
+            const auto now = std::chrono::system_clock::now();
+
+            std::lock_guard lock{mutex_};
+            for (const auto& event : batch) {
+                samples_.push_back(
+                    static_cast<std::uint64_t>(std::max<std::int64_t>(0, (now - event.time_point.time_point).count())));
+            }
+        }
+
+        void flush() override {
+            inner_->flush();
+        }
+
+        [[nodiscard]] bool should_log(const LogLevel lvl, const std::string_view prefix) const noexcept override {
+            return inner_->should_log(lvl, prefix);
+        }
+
+        [[nodiscard]] bench::LatencySummary summarize() {
+            std::lock_guard lock{mutex_};
+            using period = std::chrono::system_clock::period;
+            return bench::summarize_latency(samples_, 1e9 * period::num / period::den);
+        }
+
+    private:
+        std::shared_ptr<Sink> inner_;
+        std::mutex mutex_;
+        std::vector<std::uint64_t> samples_;
+    };
+
+    constexpr std::string_view wait_strategy_name(const LoggerConfig::WaitStrategy strategy) {
+        switch (strategy) {
+            case LoggerConfig::WaitStrategy::BusySpin:
+                return "busy_spin";
+            case LoggerConfig::WaitStrategy::Yielding:
+                return "yielding";
+            case LoggerConfig::WaitStrategy::Blocking:
+                return "blocking";
+        }
+        return "unknown";
+    }
+
+    constexpr LoggerConfig::WaitStrategy all_wait_strategies[] = {
+        LoggerConfig::WaitStrategy::BusySpin,
+        LoggerConfig::WaitStrategy::Yielding,
+        LoggerConfig::WaitStrategy::Blocking,
+    };
+
+    constexpr std::string_view all_sinks[] = {"null", "file", "mmap", "zstd", "json"};
+
+    const std::filesystem::path bench_dir = "scroll_suite_logs";
+
+    std::unique_ptr<Logger> make_logger(const LoggerConfig::WaitStrategy strategy) {
+        return std::make_unique<Logger>(LoggerConfig::Builder{}
+                                            .wait_strategy(strategy)
+                                            .ring_buffer_size(LoggerConfig::BufferCapacity::Medium)
+                                            .finalize());
+    }
+
+    std::shared_ptr<Sink> make_file_sink() {
+        using namespace demiplane::gears::literals;
+        return std::make_shared<FileSink<DetailedEntry>>(FileSinkConfig::Builder{}
+                                                             .threshold(LogLevel::Debug)
+                                                             .file(bench_dir / "file.log")
+                                                             .add_time_to_filename(false)
+                                                             .max_file_size(4_gb)
+                                                             .flush_each_entry(false)
+                                                             .rotation(false)
+                                                             .finalize());
+    }
+
+    void reset_bench_dir() {
+        std::filesystem::remove_all(bench_dir);
+        std::filesystem::create_directories(bench_dir);
+    }
+
+    std::shared_ptr<Sink> make_sink(const std::string_view kind) {
+        static NullBuffer null_buffer;
+        static std::ostream null_stream{&null_buffer};
+
+        reset_bench_dir();
+
+        if (kind == "file") {
+            return make_file_sink();
+        }
+        if (kind == "mmap") {
+            return std::make_shared<MmapFileSink<DetailedEntry>>(MmapFileSinkConfig::Builder{}
+                                                                     .threshold(LogLevel::Debug)
+                                                                     .file(bench_dir / "mmap.log")
+                                                                     .add_time_to_filename(false)
+                                                                     .finalize());
+        }
+        if (kind == "zstd") {
+            return std::make_shared<CompressedFileSink<DetailedEntry>>(CompressedFileSinkConfig::Builder{}
+                                                                           .threshold(LogLevel::Debug)
+                                                                           .file(bench_dir / "zstd.log.zst")
+                                                                           .add_time_to_filename(false)
+                                                                           .finalize());
+        }
+        if (kind == "json") {
+            return std::make_shared<JsonSink>(StructuredSinkConfig::Builder{}.output(&null_stream).finalize());
+        }
+        return std::make_shared<NullSink>();
+    }
+
+    void log_payload(Logger& logger, const std::string& payload) {
+        logger.log(LogLevel::Debug, std::string_view{}, std::source_location::current(), "{}", payload);
+    }
+
+    /// Per-call producer latency: every wait strategy × thread count × message size, null sink
+    void producer_latency(const bench::SuiteOptions& options, bench::JsonReport& report) {
+        for (const auto strategy : all_wait_strategies) {
+            for (const std::size_t threads : options.threads) {
+                for (const std::size_t size : options.message_sizes) {
+                    const auto payload = bench::make_payload(size);
+                    auto logger        = make_logger(strategy);
+                    logger->add_sink(std::make_shared<NullSink>());
+
+                    const auto result = bench::run_latency_benchmark(
+                        threads, options.iterations, [&] { log_payload(*logger, payload); });
+                    logger->shutdown();
+
+                    report.add(bench::Record{
+                        .scenario           = "producer_latency",
+                        .wait_strategy      = std::string{wait_strategy_name(strategy)},
+                        .sink               = "null",
+                        .threads            = threads,
+                        .message_size       = size,
+                        .entries_per_second = result.run.entries_per_second,
+                        .latency            = result.latency,
+                    });
+                }
+            }
+        }
+    }
+
+    /// Per-call producer latency against each real sink (throughput includes the drain at shutdown)
+    void sink_matrix(const bench::SuiteOptions& options, bench::JsonReport& report) {
+        for (const auto sink_kind : all_sinks) {
+            for (const std::size_t threads : options.sink_threads) {
+                for (const std::size_t size : options.message_sizes) {
+                    const auto payload = bench::make_payload(size);
+                    auto logger        = make_logger(LoggerConfig::WaitStrategy::Yielding);
+                    logger->add_sink(make_sink(sink_kind));
+
+                    const auto start  = std::chrono::steady_clock::now();
+                    const auto result = bench::run_latency_benchmark(
+                        threads, options.iterations, [&] { log_payload(*logger, payload); });
+                    logger->shutdown();
+                    const double drained_sec =
+                        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                    report.add(bench::Record{
+                        .scenario           = "sink",
+                        .wait_strategy      = "yielding",
+                        .sink               = std::string{sink_kind},
+                        .threads            = threads,
+                        .message_size       = size,
+                        .entries_per_second = static_cast<double>(threads * options.iterations) / drained_sec,
+                        .latency            = result.latency,
+                    });
+                }
+            }
+        }
+    }
+
+    /// Log call → line written and flushed by the file sink
+    void end_to_end(const bench::SuiteOptions& options, bench::JsonReport& report) {
+        for (const std::size_t threads : options.sink_threads) {
+            for (const std::size_t size : options.message_sizes) {
+                const auto payload = bench::make_payload(size);
+                auto logger        = make_logger(LoggerConfig::WaitStrategy::Yielding);
+                reset_bench_dir();
+                auto probe = std::make_shared<LatencyProbeSink>(make_file_sink(), threads * options.iterations);
+                logger->add_sink(probe);
+
+                const auto result =
+                    bench::run_latency_benchmark(threads, options.iterations, [&] { log_payload(*logger, payload); });
+                logger->shutdown();
+
+                report.add(bench::Record{
+                    .scenario           = "end_to_end",
+                    .wait_strategy      = "yielding",
+                    .sink               = "file",
+                    .threads            = threads,
+                    .message_size       = size,
+                    .entries_per_second = result.run.entries_per_second,
+                    .latency            = probe->summarize(),
+                });
+            }
+        }
+    }
+
+    /// Flat-out logging for options.sustain: throughput the file sink can absorb and how often producers stall
+    void sustained(const bench::SuiteOptions& options, bench::JsonReport& report) {
+        for (const std::size_t threads : options.sink_threads) {
+            const auto payload = bench::make_payload(256);
+            auto logger        = make_logger(LoggerConfig::WaitStrategy::Yielding);
+            logger->add_sink(make_sink("file"));
+
+            const auto result = bench::run_sustained_benchmark(
+                threads, options.sustain, std::chrono::microseconds{100}, [&] { log_payload(*logger, payload); });
+            logger->shutdown();
+
+            report.add(bench::Record{
+                .scenario           = "sustained",
+                .wait_strategy      = "yielding",
+                .sink               = "file",
+                .threads            = threads,
+                .message_size       = payload.size(),
+                .entries_per_second = result.entries_per_second,
+                .latency            = result.latency,
+                .stalls             = result.stalls,
+            });
+        }
+    }
+}  // namespace
+
+int main(const int argc, char** argv) {
+    const auto options = bench::parse_suite_options(argc, argv);
+    bench::JsonReport report{"scroll", options.commit};
+
+    std::cout << "Scroll Logger Benchmark Suite\n";
+    producer_latency(options, report);
+    sink_matrix(options, report);
+    end_to_end(options, report);
+    sustained(options, report);
+
+    std::filesystem::remove_all(bench_dir);
+    report.write(options.json_path);
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <filesystem>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+
+#include "latency_harness.hpp"
+
+namespace {
+    const std::filesystem::path bench_dir = "spdlog_suite_logs";
+
+    /// Async logger over one backend thread, blocking on overflow — the closest match to Scroll's defaults
+    std::shared_ptr<spdlog::async_logger> make_logger(spdlog::sink_ptr sink) {
+        spdlog::init_thread_pool(8192, 1);
+        auto logger = std::make_shared<spdlog::async_logger>(
+            "bench", std::move(sink), spdlog::thread_pool(), spdlog::async_overflow_policy::block);
+        logger->set_level(spdlog::level::debug);
+        return logger;
+    }
+
+    spdlog::sink_ptr make_sink(const std::string_view kind) {
+        std::filesystem::remove_all(bench_dir);
+        std::filesystem::create_directories(bench_dir);
+        if (kind == "file") {
+            return std::make_shared<spdlog::sinks::basic_file_sink_mt>((bench_dir / "file.log").string(), true);
+        }
+        return std::make_shared<spdlog::sinks::null_sink_mt>();
+    }
+
+    void finish(const std::shared_ptr<spdlog::async_logger>& logger) {
+        logger->flush();
+        spdlog::shutdown();
+    }
+}  // namespace
+
+int main(const int argc, char** argv) {
+    const auto options = bench::parse_suite_options(argc, argv);
+    bench::JsonReport report{"spdlog", options.commit};
+
+    std::cout << "spdlog Benchmark Suite\n";
+
+    for (const std::size_t threads : options.threads) {
+        for (const std::size_t size : options.message_sizes) {
+            const auto payload = bench::make_payload(size);
+            auto logger        = make_logger(make_sink("null"));
+
+            const auto result = bench::run_latency_benchmark(
+                threads, options.iterations, [&] { logger->debug("{}", payload); });
+            finish(logger);
+
+            report.add(bench::Record{
+                .scenario           = "producer_latency",
+                .wait_strategy      = "n/a",
+                .sink               = "null",
+                .threads            = threads,
+                .message_size       = size,
+                .entries_per_second = result.run.entries_per_second,
+                .latency            = result.latency,
+            });
+        }
+    }
+
+    for (const std::size_t threads : options.sink_threads) {
+        for (const std::size_t size : options.message_sizes) {
+            const auto payload = bench::make_payload(size);
+            auto logger        = make_logger(make_sink("file"));
+
+            const auto start  = std::chrono::steady_clock::now();
+            const auto result = bench::run_latency_benchmark(
+                threads, options.iterations, [&] { logger->debug("{}", payload); });
+            finish(logger);
+            const double drained_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            report.add(bench::Record{
+                .scenario           = "sink",
+                .wait_strategy      = "n/a",
+                .sink               = "file",
+                .threads            = threads,
+                .message_size       = size,
+                .entries_per_second = static_cast<double>(threads * options.iterations) / drained_sec,
+                .latency            = result.latency,
+            });
+        }
+    }
+
+    for (const std::size_t threads : options.sink_threads) {
+        const auto payload = bench::make_payload(256);
+        auto logger        = make_logger(make_sink("file"));
+
+        const auto result = bench::run_sustained_benchmark(
+            threads, options.sustain, std::chrono::microseconds{100}, [&] { logger->debug("{}", payload); });
+        finish(logger);
+
+        report.add(bench::Record{
+            .scenario           = "sustained",
+            .wait_strategy      = "n/a",
+            .sink               = "file",
+            .threads            = threads,
+            .message_size       = payload.size(),
+            .entries_per_second = result.entries_per_second,
+            .latency            = result.latency,
+            .stalls             = result.stalls,
+        });
+    }
+
+    std::filesystem::remove_all(bench_dir);
+    report.write(options.json_path);
+    return 0;
+}
@@ -6,6 +6,10 @@ option(DMP_ENABLE_LOGGING "Enable end user logging" ON)
 
 if (DMP_ENABLE_LOGGING)
     option(DMP_COMPONENT_LOGGING "Enable logging in components" ON)
+    set(DMP_SCROLL_MIN_LEVEL "" CACHE STRING
+            "Lowest log level compiled in (Trace..Fatal); empty: Debug in Release builds, Trace otherwise")
+    set(DMP_SCROLL_COMPONENT_LEVELS "" CACHE STRING
+            "Per-component compile-time levels, e.g. AsyncExecutor=Info,RouteRegistry=Warning")
 endif ()
 
 #Component option
@@ -1,11 +1,14 @@
 #pragma once
 #include <chrono>
-#include <cstdio>
+#include <cstdint>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <string_view>
 
+#include <gears_itoa.hpp>
+
 namespace demiplane::chrono {
     // ─────────────── Base clock (parse & now) ───────────────
     class Clock {
@@ -50,68 +53,65 @@ namespace demiplane::chrono {
         }
 
         static std::string format_time_iso_ms(const sys_tp tp) {
-            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()) % 1000;
-            const auto tm = to_tm(tp);
-            char timestamp[32];
-            std::int32_t len;
-            if constexpr (CT == ClockType::UTC) {
-                len = snprintf(timestamp,
-                               sizeof(timestamp),
-                               "%04d-%02d-%02dT%02d:%02d:%02d.%03lldZ",
-                               tm.tm_year + 1900,
-                               tm.tm_mon + 1,
-                               tm.tm_mday,
-                               tm.tm_hour,
-                               tm.tm_min,
-                               tm.tm_sec,
-                               ms.count());
-            } else {
-                len = snprintf(timestamp,
-                               sizeof(timestamp),
-                               "%04d-%02d-%02dT%02d:%02d:%02d.%03lld ",
-                               tm.tm_year + 1900,
-                               tm.tm_mon + 1,
-                               tm.tm_mday,
-                               tm.tm_hour,
-                               tm.tm_min,
-                               tm.tm_sec,
-                               ms.count());
-            }
-
-            return {timestamp, static_cast<std::size_t>(len)};
+            std::string out;
+            out.reserve(iso_ms_length);
+            append_iso_ms(tp, out);
+            return out;
         }
 
         static void format_time_iso_ms(const sys_tp tp, std::string& out) {
-            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()) % 1000;
-            const auto tm = to_tm(tp);
-            char timestamp[32];
-            std::int32_t len;
-            if constexpr (CT == ClockType::UTC) {
-                len = snprintf(timestamp,
-                               sizeof(timestamp),
-                               "%04d-%02d-%02dT%02d:%02d:%02d.%03lldZ",
-                               tm.tm_year + 1900,
-                               tm.tm_mon + 1,
-                               tm.tm_mday,
-                               tm.tm_hour,
-                               tm.tm_min,
-                               tm.tm_sec,
-                               ms.count());
-            } else {
-                len = snprintf(timestamp,
-                               sizeof(timestamp),
-                               "%04d-%02d-%02dT%02d:%02d:%02d.%03lld ",
-                               tm.tm_year + 1900,
-                               tm.tm_mon + 1,
-                               tm.tm_mday,
-                               tm.tm_hour,
-                               tm.tm_min,
-                               tm.tm_sec,
-                               ms.count());
+            append_iso_ms(tp, out);
+        }
+
+        /// Length of "YYYY-MM-DDTHH:MM:SS.mmm" plus the trailing 'Z' (UTC) or ' ' (Local)
+        static constexpr std::size_t iso_ms_length = 24;
+
+        /**
+         * @brief Append "YYYY-MM-DDTHH:MM:SS.mmmZ" (UTC) or "YYYY-MM-DDTHH:MM:SS.mmm " (Local) to @p out
+         *
+         * The "YYYY-MM-DDTHH:MM:SS" part is cached per thread and rebuilt only when the
+         * second changes — within a second a call is a compare, a 19-byte copy and three
+         * digits. No snprintf on either path.
+         */
+        static void append_iso_ms(const sys_tp tp, std::string& out) {
+            struct SecondCache {
+                std::int64_t second = std::numeric_limits<std::int64_t>::min();
+                char text[19]{};
+            };
+            thread_local SecondCache cache;
+
+            const auto second = std::chrono::floor<std::chrono::seconds>(tp);
+            const auto ms =
+                static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(tp - second).count());
+
+            if (const std::int64_t key = second.time_since_epoch().count(); key != cache.second) {
+                const auto tm   = to_tm(second);
+                const auto year = static_cast<std::uint32_t>(tm.tm_year + 1900);
+                gears::write_2digits(cache.text, year / 100 % 100);
+                gears::write_2digits(cache.text + 2, year % 100);
+                cache.text[4] = '-';
+                gears::write_2digits(cache.text + 5, static_cast<std::uint32_t>(tm.tm_mon + 1));
+                cache.text[7] = '-';
+                gears::write_2digits(cache.text + 8, static_cast<std::uint32_t>(tm.tm_mday));
+                cache.text[10] = 'T';
+                gears::write_2digits(cache.text + 11, static_cast<std::uint32_t>(tm.tm_hour));
+                cache.text[13] = ':';
+                gears::write_2digits(cache.text + 14, static_cast<std::uint32_t>(tm.tm_min));
+                cache.text[16] = ':';
+                gears::write_2digits(cache.text + 17, static_cast<std::uint32_t>(tm.tm_sec));
+                cache.second = key;
             }
 
-            out.append(timestamp, static_cast<std::size_t>(len));
+            char tail[5];
+            tail[0] = '.';
+            tail[1] = static_cast<char>('0' + ms / 100);
+            gears::write_2digits(tail + 2, ms % 100);
+            tail[4] = CT == ClockType::UTC ? 'Z' : ' ';
+
+            out.append(cache.text, sizeof(cache.text));
+            out.append(tail, sizeof(tail));
         }
+
         [[nodiscard]] static std::string format_time(const sys_tp tp, const std::string_view format) {
             std::ostringstream ss;
             const std::tm buf = to_tm(tp);
@@ -0,0 +1,198 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #include <x86intrin.h>
+#endif
+
+namespace demiplane::chrono {
+    /**
+     * @brief Mapping from raw CPU counter ticks to nanoseconds and wall time
+     *
+     * Built from (ticks, steady_clock, system_clock) samples. The rate comes from
+     * the first and latest sample against steady_clock, so it sharpens the longer
+     * the calibration lives and ignores wall-clock steps; the wall anchor is the
+     * latest sample, so drift never accumulates past one refresh interval.
+     * A calibration object is not thread-safe to refresh — give each refreshing
+     * thread its own copy.
+     */
+    class TscCalibration {
+    public:
+        /**
+         * @brief Calibrate by sampling the counter against steady_clock over @p window
+         *
+         * Blocks the caller for @p window.
+         */
+        [[nodiscard]] static TscCalibration measure(std::chrono::nanoseconds window = std::chrono::milliseconds{10});
+
+        /// Counter ticks -> nanoseconds since the calibration's first sample
+        [[nodiscard]] std::int64_t to_ns(const std::uint64_t ticks) const noexcept {
+            return static_cast<std::int64_t>(static_cast<double>(static_cast<std::int64_t>(ticks - origin_.ticks)) *
+                                             ns_per_tick_);
+        }
+
+        /// Counter ticks -> wall time
+        [[nodiscard]] std::chrono::system_clock::time_point to_sys(const std::uint64_t ticks) const noexcept {
+            const auto since_anchor = static_cast<std::int64_t>(
+                static_cast<double>(static_cast<std::int64_t>(ticks - anchor_.ticks)) * ns_per_tick_);
+            return std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds{anchor_.wall_ns + since_anchor})};
+        }
+
+        /**
+         * @brief Take a new sample if the current anchor is older than @p interval
+         * @return true if the calibration was refreshed
+         *
+         * Cheap enough to call on every iteration of a consumer loop: the common
+         * case is one counter read and a compare.
+         */
+        bool refresh(std::chrono::nanoseconds interval = std::chrono::seconds{1}) noexcept;
+
+        [[nodiscard]] double ns_per_tick() const noexcept {
+            return ns_per_tick_;
+        }
+
+    private:
+        struct Sample {
+            std::uint64_t ticks;
+            std::int64_t steady_ns;
+            std::int64_t wall_ns;
+        };
+
+        Sample origin_{};
+        Sample anchor_{};
+        std::uint64_t refresh_ticks_      = 0;  // anchor ticks + refresh interval, cached in ticks
+        std::int64_t refresh_interval_ns_ = 0;
+        double ns_per_tick_               = 1.0;
+
+        void update_rate(const Sample& latest) noexcept;
+        void schedule_refresh() noexcept;
+
+        [[nodiscard]] static Sample sample() noexcept;
+    };
+
+    /**
+     * @brief std::chrono-compatible clock over the CPU cycle counter
+     *
+     * - x86-64: rdtsc (only meaningful with an invariant TSC — see is_invariant())
+     * - AArch64: cntvct_el0
+     * - elsewhere: falls back to steady_clock
+     *
+     * ticks() is the few-cycle capture for hot paths (log producers); convert
+     * later with a TscCalibration, and only trust the result if is_invariant().
+     * now() converts on the spot using a process-wide calibration, so TscClock
+     * drops into Stopwatch<D, TscClock>. Without an invariant counter now() reads
+     * steady_clock instead, which is what keeps is_steady true on every CPU.
+     */
+    class TscClock {
+    public:
+        using rep                       = std::int64_t;
+        using period                    = std::nano;
+        using duration                  = std::chrono::nanoseconds;
+        using time_point                = std::chrono::time_point<TscClock>;
+        static constexpr bool is_steady = true;  // see now()
+
+        [[nodiscard]] static std::uint64_t ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#elif defined(__aarch64__)
+            std::uint64_t value;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+            return value;
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count());
+#endif
+        }
+
+        [[nodiscard]] static time_point now() noexcept {
+            if (!is_invariant()) {
+                return time_point{std::chrono::duration_cast<duration>(
+                    std::chrono::steady_clock::now().time_since_epoch())};
+            }
+            return time_point{duration{calibration().to_ns(ticks())}};
+        }
+
+        /**
+         * @brief Process-wide calibration, measured once on first use (blocks ~10ms then)
+         */
+        [[nodiscard]] static const TscCalibration& calibration() {
+            static const TscCalibration instance = TscCalibration::measure();
+            return instance;
+        }
+
+        /**
+         * @brief Whether ticks() advance at a constant rate across cores and power states
+         *
+         * Without it, cycle counts still time short intervals on one core, but
+         * converting them to wall time is unreliable. Checked once per process.
+         */
+        [[nodiscard]] static bool is_invariant() noexcept {
+            static const bool invariant = detect_invariant();
+            return invariant;
+        }
+
+    private:
+        [[nodiscard]] static bool detect_invariant() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+            unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+                return false;
+            }
+            return (edx & (1U << 8)) != 0;  // CPUID.80000007H:EDX[8] — invariant TSC
+#else
+            return true;  // cntvct_el0 / steady_clock run at a fixed frequency
+#endif
+        }
+    };
+
+    inline TscCalibration::Sample TscCalibration::sample() noexcept {
+        // Bracket the clock reads and take the midpoint — halves the error from
+        // preemption between the reads
+        const std::uint64_t before = TscClock::ticks();
+        const auto steady          = std::chrono::steady_clock::now();
+        const auto wall            = std::chrono::system_clock::now();
+        const std::uint64_t after  = TscClock::ticks();
+        return {before + (after - before) / 2,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(steady.time_since_epoch()).count(),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(wall.time_since_epoch()).count()};
+    }
+
+    inline TscCalibration TscCalibration::measure(const std::chrono::nanoseconds window) {
+        TscCalibration result;
+        result.origin_ = sample();
+        std::this_thread::sleep_for(window);
+        result.update_rate(sample());
+        return result;
+    }
+
+    inline bool TscCalibration::refresh(const std::chrono::nanoseconds interval) noexcept {
+        if (interval.count() != refresh_interval_ns_) {
+            refresh_interval_ns_ = interval.count();
+            schedule_refresh();
+        }
+        if (TscClock::ticks() < refresh_ticks_) {
+            return false;
+        }
+        update_rate(sample());
+        return true;
+    }
+
+    inline void TscCalibration::update_rate(const Sample& latest) noexcept {
+        if (latest.ticks > origin_.ticks && latest.steady_ns > origin_.steady_ns) {
+            ns_per_tick_ = static_cast<double>(latest.steady_ns - origin_.steady_ns) /
+                           static_cast<double>(latest.ticks - origin_.ticks);
+        }
+        anchor_ = latest;
+        schedule_refresh();
+    }
+
+    inline void TscCalibration::schedule_refresh() noexcept {
+        refresh_ticks_ =
+            anchor_.ticks + static_cast<std::uint64_t>(static_cast<double>(refresh_interval_ns_) / ns_per_tick_);
+    }
+}  // namespace demiplane::chrono
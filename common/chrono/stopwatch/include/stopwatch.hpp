@@ -4,6 +4,8 @@
 #include <utility>
 #include <vector>
 
+#include "tsc_clock.hpp"
+
 namespace demiplane::chrono {
 
     template <typename duration = std::chrono::milliseconds, typename clock = std::chrono::high_resolution_clock>
@@ -86,4 +88,8 @@ namespace demiplane::chrono {
         std::vector<time_point> flags_;
     };
 
+    /// Cycle-counter stopwatch: flags cost a counter read instead of a clock call
+    template <typename duration = std::chrono::nanoseconds>
+    using TscStopwatch = Stopwatch<duration, TscClock>;
+
 }  // namespace demiplane::chrono
@@ -0,0 +1,100 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace demiplane::gears {
+    namespace detail {
+        /// "00" "01" ... "99" — two digits per lookup halves the number of divisions
+        inline constexpr char digit_pairs[] = "00010203040506070809"
+                                              "10111213141516171819"
+                                              "20212223242526272829"
+                                              "30313233343536373839"
+                                              "40414243444546474849"
+                                              "50515253545556575859"
+                                              "60616263646566676869"
+                                              "70717273747576777879"
+                                              "80818283848586878889"
+                                              "90919293949596979899";
+
+        inline constexpr std::array<std::uint64_t, 20> powers_of_10 = {
+            1ULL,
+            10ULL,
+            100ULL,
+            1'000ULL,
+            10'000ULL,
+            100'000ULL,
+            1'000'000ULL,
+            10'000'000ULL,
+            100'000'000ULL,
+            1'000'000'000ULL,
+            10'000'000'000ULL,
+            100'000'000'000ULL,
+            1'000'000'000'000ULL,
+            10'000'000'000'000ULL,
+            100'000'000'000'000ULL,
+            1'000'000'000'000'000ULL,
+            10'000'000'000'000'000ULL,
+            100'000'000'000'000'000ULL,
+            1'000'000'000'000'000'000ULL,
+            10'000'000'000'000'000'000ULL,
+        };
+    }  // namespace detail
+
+    /// Longest decimal representation of a std::uint64_t
+    inline constexpr std::size_t max_decimal_digits = 20;
+
+    /**
+     * @brief Number of decimal digits in @p value (1 for 0)
+     *
+     * No loop and no compare chain: bit_width * log10(2) (as 1233 / 4096) gives the
+     * digit count or one less, and a single table compare settles which.
+     */
+    [[nodiscard]] constexpr std::size_t decimal_digits(const std::uint64_t value) noexcept {
+        const std::uint64_t nonzero = value | 1;  // 0 prints as one digit, like 1
+        const auto approx           = static_cast<std::size_t>(std::bit_width(nonzero) * 1233) >> 12;
+        return approx + static_cast<std::size_t>(nonzero >= detail::powers_of_10[approx]);
+    }
+
+    /**
+     * @brief Write exactly two digits of @p value (< 100) — zero-padded, e.g. 7 -> "07"
+     */
+    constexpr void write_2digits(char* out, const std::uint32_t value) noexcept {
+        out[0] = detail::digit_pairs[value * 2];
+        out[1] = detail::digit_pairs[value * 2 + 1];
+    }
+
+    /**
+     * @brief Write @p value in decimal to @p out, no terminator
+     * @param out At least decimal_digits(value) chars (max_decimal_digits always suffices)
+     * @return Number of chars written
+     *
+     * Digits are produced back to front, two per division, into a length known
+     * up front — no per-digit branches, no locale, no format-string parsing.
+     */
+    constexpr std::size_t write_decimal(char* out, std::uint64_t value) noexcept {
+        const std::size_t length = decimal_digits(value);
+        char* pos                = out + length;
+        while (value >= 100) {
+            pos -= 2;
+            write_2digits(pos, static_cast<std::uint32_t>(value % 100));
+            value /= 100;
+        }
+        if (value >= 10) {
+            write_2digits(pos - 2, static_cast<std::uint32_t>(value));
+        } else {
+            pos[-1] = static_cast<char>('0' + value);
+        }
+        return length;
+    }
+
+    /**
+     * @brief Append @p value in decimal to @p out
+     */
+    inline void append_decimal(std::string& out, const std::uint64_t value) {
+        char buffer[max_decimal_digits];
+        out.append(buffer, write_decimal(buffer, value));
+    }
+}  // namespace demiplane::gears
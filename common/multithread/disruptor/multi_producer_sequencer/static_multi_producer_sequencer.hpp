@@ -403,6 +403,22 @@ namespace demiplane::multithread {
             gating_sequence_.set(sequence);
         }
 
+        /**
+         * @brief Move the gating sequence forward to @p sequence, never backward
+         * @param sequence Highest sequence released by the caller
+         *
+         * For consumers that release slots from several threads (e.g. the last
+         * of N downstream handlers to finish a batch). Two releasers can race —
+         * with a plain set() the older one could land last and move gating
+         * backwards, leaving producers waiting on slots that are already free.
+         * The CAS loop keeps the maximum.
+         */
+        void advance_gating_sequence(const std::int64_t sequence) noexcept {
+            std::int64_t current = gating_sequence_.get();
+            while (current < sequence && !gating_sequence_.compare_and_set(current, sequence)) {
+            }
+        }
+
         /**
          * @brief Get current claimed cursor value
          * @return Highest claimed sequence
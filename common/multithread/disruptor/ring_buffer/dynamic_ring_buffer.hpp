@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 namespace demiplane::multithread {
@@ -106,6 +109,21 @@ namespace demiplane::multithread {
             return get(sequence);
         }
 
+        /**
+         * @brief Slots [first, last] as one contiguous view, cut short at the physical end of storage
+         * @param first First sequence of the run
+         * @param last Last sequence of the run (inclusive, last - first < capacity())
+         * @return View of the slots from @p first up to @p last or the end of storage,
+         *         whichever comes first — call again from first + size() for the rest
+         *
+         * Example: BufferSize = 8, contiguous(6, 9) -> buffer_[6..7]; contiguous(8, 9) -> buffer_[0..1]
+         */
+        [[nodiscard]] std::span<const T> contiguous(const std::int64_t first, const std::int64_t last) const noexcept {
+            const std::size_t begin = static_cast<std::size_t>(first) & index_mask_;
+            const std::size_t count = std::min(static_cast<std::size_t>(last - first + 1), buffer_size_ - begin);
+            return {buffer_.data() + begin, count};
+        }
+
         /**
          * @brief Get buffer capacity
          * @return Maximum number of elements
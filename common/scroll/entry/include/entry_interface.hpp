@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cinttypes>
+#include <cstdio>
 #include <demiplane/chrono>
 #include <demiplane/gears>
 #include <source_location>
@@ -104,10 +105,27 @@ namespace demiplane::scroll {
 
         struct MetaTimePoint {
             std::chrono::time_point<std::chrono::system_clock> time_point;
+            /// Raw TscClock ticks while wall time is still pending; 0 once time_point is set
+            std::uint64_t tsc_ticks = 0;
 
             MetaTimePoint() noexcept
                 : time_point{chrono::Clock::now()} {
             }
+
+            struct TscCapture {};
+
+            /// Producer side: a few-cycle counter read instead of a clock call — see resolve()
+            explicit MetaTimePoint(TscCapture) noexcept
+                : tsc_ticks{chrono::TscClock::ticks()} {
+            }
+
+            /// Consumer side: turn captured ticks into wall time
+            void resolve(const chrono::TscCalibration& calibration) noexcept {
+                if (tsc_ticks != 0) {
+                    time_point = calibration.to_sys(tsc_ticks);
+                    tsc_ticks  = 0;
+                }
+            }
         };
 
         template <class... Metas>
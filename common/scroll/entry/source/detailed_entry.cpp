@@ -3,20 +3,14 @@
 #include <cstring>
 #include <demiplane/chrono>
 
-namespace {
-    void append_number(std::string& buf, const uint32_t value) {
-        char temp[16];
-        snprintf(temp, sizeof(temp), "%u", value);
-        buf.append(temp);
-    }
-}  // namespace
+#include <gears_itoa.hpp>
 
 namespace demiplane::scroll {
     void DetailedEntry::format_into(std::string& out) const {
         out.clear();
         out.reserve(160 + message_.size());
 
-        chrono::UTCClock::format_time_iso_ms(time_point, out);
+        chrono::UTCClock::append_iso_ms(time_point, out);
 
         out.push_back(' ');
         out.append(level_cstr());
@@ -45,7 +39,7 @@ namespace demiplane::scroll {
         out.append(fname);
 
         out.push_back(':');
-        append_number(out, location.line());
+        gears::append_decimal(out, location.line());
 
         out.append("] ");
         out.append(message_);
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <csignal>
+#include <cstddef>
+#include <string_view>
+
+#include <unistd.h>
+
+namespace demiplane::scroll {
+    class Logger;
+
+    /**
+     * @brief Opt-in last-gasp dump of buffered log output on fatal signals
+     *
+     * Once install() is called, SIGSEGV / SIGABRT / SIGBUS run a handler that:
+     * 1. Lets every sink of every live Logger write out what it still buffers
+     *    (Sink::crash_flush — e.g. the unflushed part of FileSink's stream buffer)
+     * 2. Writes ring events that not every sink has finished yet, raw
+     *    ("LVL [prefix] message"), to the crash fd
+     * 3. Writes a backtrace of the faulting thread to the crash fd
+     * 4. Restores the previous disposition and re-raises the signal
+     *
+     * Everything on that path is async-signal-safe: atomics, plain memory reads
+     * and write(2). Loggers register themselves on construction; up to
+     * max_loggers are tracked, further ones are silently skipped.
+     *
+     * Runs already handed to sink strands are included, so a line a sink wrote just
+     * before the crash may appear twice. Not covered: events copied into a decoupled
+     * sink's own queue (see Logger).
+     *
+     * Usage:
+     *   int main() {
+     *       CrashHandler::install();              // stderr
+     *       CrashHandler::install(crash_log_fd);  // or a dedicated fd
+     *   }
+     */
+    class CrashHandler {
+    public:
+        static constexpr std::size_t max_loggers = 16;
+
+        /**
+         * @brief Install handlers for SIGSEGV, SIGABRT and SIGBUS
+         * @param fd Destination of ring contents and backtrace (stderr by default)
+         *
+         * Idempotent — a second call only changes the fd. The calling thread also gets an
+         * alternate signal stack, so a stack overflow on that thread is still reported.
+         * Sinks of live Loggers get Sink::prepare_crash_flush() here, sinks added later on add_sink().
+         */
+        static void install(int fd = STDERR_FILENO);
+
+        /// Restore the dispositions that were active before install()
+        static void uninstall() noexcept;
+
+        [[nodiscard]] static bool installed() noexcept;
+
+        /// Called by Logger on construction / destruction
+        static void register_logger(const Logger* logger) noexcept;
+        static void unregister_logger(const Logger* logger) noexcept;
+
+        /**
+         * @brief Run steps 1-3 of the handler without a signal
+         *
+         * Async-signal-safe; useful to dump state from an existing handler.
+         */
+        static void dump(int fd) noexcept;
+    };
+
+    /**
+     * @brief Reopen log files on a signal — the postrotate hook of logrotate
+     *
+     * The handler only calls Logger::request_reopen() on every Logger tracked by
+     * CrashHandler; each consumer then reopens its sinks before the next dispatch.
+     *
+     * Usage (logrotate: postrotate kill -HUP $(cat app.pid) endscript):
+     *   ReopenSignal::install();         // SIGHUP
+     *   ReopenSignal::install(SIGUSR1);  // or another signal
+     */
+    class ReopenSignal {
+    public:
+        /// Install the handler for @p sig; a second call moves it to the new signal
+        static void install(int sig = SIGHUP);
+
+        /// Restore the disposition that was active before install()
+        static void uninstall() noexcept;
+    };
+
+    namespace detail {
+        /// write(2) until everything is written or an error other than EINTR occurs
+        void write_raw(int fd, std::string_view data) noexcept;
+    }  // namespace detail
+}  // namespace demiplane::scroll
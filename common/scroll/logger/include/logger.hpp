@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <thread>
 #include <vector>
 
@@ -15,7 +16,9 @@
 #include <boost/asio/strand.hpp>
 #include <boost/asio/thread_pool.hpp>
 
+#include "crash_handler.hpp"
 #include "logger_config.hpp"
+#include "sink_channel.hpp"
 #include "sink_interface.hpp"
 namespace demiplane::scroll {
     /**
@@ -34,11 +37,34 @@ namespace demiplane::scroll {
      * Performance:
      * - ~10M events/sec throughput
      * - Sub-microsecond latency (P99 < 1μs)
-     * - Zero heap allocations on hot path (pre-allocated ring buffer)
+     * - Format-string log() makes no heap allocation once warmed up (pre-allocated ring
+     *   buffer, recycled message buffers); stream() builds a std::ostringstream per call
+     * - Zero copies between producer and sink: sinks read ring slots in place
+     * - Optional cycle-counter timestamps (TimestampSource::Tsc): producers read the
+     *   counter, the consumer converts to wall time with a periodically refreshed calibration
+     *
+     * Dispatch:
+     *   The consumer hands each published run of slots to every sink as spans over the
+     *   ring and moves on without waiting. The last sink to finish a run advances the
+     *   gating sequence, so slots are reused only after all sinks are done with them.
+     *   The ring size therefore bounds how far the slowest sink may fall behind —
+     *   beyond that, producers wait in next().
+     *
+     *   Sinks added with SinkOptions::OverflowPolicy::Drop / Summary opt out of that
+     *   back-pressure: the consumer copies each run into the sink's own bounded queue and
+     *   releases the slots for it at once. When the queue is full the excess is dropped
+     *   and counted, so a stalled sink (a blocked TTY) costs neither memory nor the
+     *   other sinks' throughput. Events still queued there are not part of crash_dump().
+     *
+     * Reconfiguration:
+     *   reconfigure() and reopen() run on the sink's strand like any batch, so they land
+     *   between two batches: nothing is lost, and no batch sees half of a new config.
+     *   request_reopen() is the async-signal-safe form — the consumer posts the reopen
+     *   before its next dispatch (see ReopenSignal for logrotate's SIGHUP).
      *
      * Usage:
      *   Logger logger;
-     *   logger.add_sink(std::make_unique<ConsoleSink<DetailedEntry>>(...));
+     *   const auto console = logger.add_sink(std::make_unique<ConsoleSink<DetailedEntry>>(...));
      *   logger.add_sink(std::make_unique<FileSink<LightEntry>>(...));
      *
      *   // Format string style
@@ -46,6 +72,9 @@ namespace demiplane::scroll {
      *
      *   // Stream style
      *   logger.stream(LogLevel::Info) << "User " << username << " logged in";
+     *
+     *   // Structured fields (written as typed keys by JsonSink / LogfmtSink)
+     *   logger.stream(LogLevel::Info) << "login" << SCROLL_FIELDS(username, attempt);
      */
     /**
      * @brief Per-sink slot: pairs a sink with its asio::strand for serial dispatch
@@ -53,6 +82,7 @@ namespace demiplane::scroll {
     struct SinkSlot {
         std::shared_ptr<Sink> sink;
         boost::asio::strand<boost::asio::any_io_executor> strand;
+        std::unique_ptr<SinkChannel> channel;  // counters, plus the bounded queue for decoupled sinks
     };
 
     class Logger {
@@ -66,9 +96,13 @@ namespace demiplane::scroll {
         constexpr explicit Logger(boost::asio::any_io_executor executor,
                                   const LoggerConfig& cfg = LoggerConfig::Builder{}.finalize())
             : disruptor_{cfg.ring_buffer_size(), create_wait_strategy(cfg.wait_strategy())},
+              pending_acks_(cfg.ring_buffer_size()),
+              tsc_timestamps_{use_tsc(cfg)},
+              tsc_calibration_{tsc_timestamps_ ? chrono::TscClock::calibration() : chrono::TscCalibration{}},
               executor_{std::move(executor)} {
             running_.store(true, std::memory_order_release);
             consumer_thread_ = std::jthread([this] { consumer_loop(); });
+            CrashHandler::register_logger(this);
         }
 
         /**
@@ -78,25 +112,105 @@ namespace demiplane::scroll {
          */
         constexpr explicit Logger(const LoggerConfig& cfg = LoggerConfig::Builder{}.finalize())
             : disruptor_{cfg.ring_buffer_size(), create_wait_strategy(cfg.wait_strategy())},
+              pending_acks_(cfg.ring_buffer_size()),
+              tsc_timestamps_{use_tsc(cfg)},
+              tsc_calibration_{tsc_timestamps_ ? chrono::TscClock::calibration() : chrono::TscCalibration{}},
               owned_pool_{std::in_place, cfg.pool_size()},
               executor_{owned_pool_->get_executor()} {
             running_.store(true, std::memory_order_release);
             consumer_thread_ = std::jthread([this] { consumer_loop(); });
+            CrashHandler::register_logger(this);
         }
 
         ~Logger() {
             shutdown();
+            CrashHandler::unregister_logger(this);
         }
 
+        /// Position of a sink in add_sink() order
+        using SinkId = std::size_t;
+
         /**
          * @brief Add a sink to receive log events
          * @param sink Shared pointer to sink (ConsoleSink, FileSink, custom)
          *
+         * @param options Overflow policy — Block (default) shares the ring's back-pressure,
+         *                Drop / Summary give the sink its own bounded queue
+         *
+         * @return Id for reconfigure() and sink_stats()
+         *
          * Each sink is paired with a strand on the executor for serial dispatch.
          * Can be called before logging starts. NOT thread-safe during logging.
          */
-        void add_sink(std::shared_ptr<Sink> sink) {
-            sink_slots_.push_back(SinkSlot{std::move(sink), boost::asio::make_strand(executor_)});
+        SinkId add_sink(std::shared_ptr<Sink> sink, const SinkOptions& options = SinkOptions::Builder{}.finalize()) {
+            if (!options.decoupled()) {
+                ++blocking_sinks_;
+            }
+            if (CrashHandler::installed()) {
+                sink->prepare_crash_flush();
+            }
+            sink_slots_.push_back(SinkSlot{
+                std::move(sink), boost::asio::make_strand(executor_), std::make_unique<SinkChannel>(options)});
+            return sink_slots_.size() - 1;
+        }
+
+        /**
+         * @brief Replace the config of a running sink between two of its batches
+         * @param id Sink returned by add_sink()
+         * @param cfg New config; the sink must implement Reconfigurable<ConfigTp>
+         * @return Ready once the sink has applied @p cfg; carries the exception if it refused
+         *
+         * Thresholds, prefix filters and outputs change without a restart: events logged
+         * before the call are written under the old config, later ones under the new one.
+         * Waits (briefly) for the consumer to hand over what is already published.
+         *
+         * @throws std::out_of_range if @p id is unknown
+         * @throws std::invalid_argument if the sink does not take a ConfigTp
+         */
+        template <typename ConfigTp>
+        std::future<void> reconfigure(const SinkId id, ConfigTp cfg) {
+            const auto& slot = sink_slots_.at(id);
+            if (dynamic_cast<Reconfigurable<ConfigTp>*>(slot.sink.get()) == nullptr) {
+                throw std::invalid_argument{"Logger::reconfigure: sink does not accept this config type"};
+            }
+            wait_dispatched();
+            return run_on_strand(slot, [cfg = std::move(cfg)](Sink& sink) mutable {
+                dynamic_cast<Reconfigurable<ConfigTp>&>(sink).set_config(std::move(cfg));
+            });
+        }
+
+        /**
+         * @brief Reopen every sink's output, e.g. after logrotate moved the files away
+         * @return Ready once every sink has reopened; carries the first failure
+         *
+         * Events logged before the call still go to the old files.
+         */
+        std::future<void> reopen() {
+            wait_dispatched();
+            return post_reopen();
+        }
+
+        /**
+         * @brief Ask the consumer to reopen() all sinks before its next dispatch
+         *
+         * Async-signal-safe (a single atomic store) — meant for a SIGHUP handler.
+         */
+        void request_reopen() const noexcept {
+            reopen_requested_.store(true, std::memory_order_release);
+        }
+
+        /**
+         * @brief Delivery counters per sink, in add_sink() order
+         *
+         * Safe to call from any thread while logging; each value is a relaxed snapshot.
+         */
+        [[nodiscard]] std::vector<SinkStats> sink_stats() const {
+            std::vector<SinkStats> stats;
+            stats.reserve(sink_slots_.size());
+            for (const auto& slot : sink_slots_) {
+                stats.push_back(slot.channel->stats());
+            }
+            return stats;
         }
 
         /**
@@ -117,7 +231,7 @@ namespace demiplane::scroll {
             thread_local std::string tl_msg_buf;
             tl_msg_buf.clear();
             std::format_to(std::back_inserter(tl_msg_buf), fmt, std::forward<Args>(args)...);
-            const auto meta = EventMeta{lvl, loc};
+            const auto meta = EventMeta{lvl, loc, tsc_timestamps_};
 
             const std::int64_t seq = disruptor_.sequencer().next();
             auto& event            = disruptor_.ring_buffer()[seq];
@@ -132,6 +246,34 @@ namespace demiplane::scroll {
             // (requires type-erased args) or querying sink filters before format.
         }
 
+        /**
+         * @brief Format-string log from a rate-limited call site (LOG_*_EVERY_N / _EVERY_MS / _RATE)
+         * @param suppressed Calls dropped at the site since the last emitted one;
+         *                   non-zero values are appended as " [suppressed N]"
+         */
+        template <typename... Args>
+        constexpr void log_sampled(const std::uint64_t suppressed,
+                                   const LogLevel lvl,
+                                   const std::string_view prefix,
+                                   const std::source_location& loc,
+                                   std::format_string<Args...> fmt,
+                                   Args&&... args) {
+            thread_local std::string tl_msg_buf;
+            tl_msg_buf.clear();
+            std::format_to(std::back_inserter(tl_msg_buf), fmt, std::forward<Args>(args)...);
+            append_suppressed(tl_msg_buf, suppressed);
+            const auto meta = EventMeta{lvl, loc, tsc_timestamps_};
+
+            const std::int64_t seq = disruptor_.sequencer().next();
+            auto& event            = disruptor_.ring_buffer()[seq];
+
+            event.message.swap(tl_msg_buf);
+            event.prefix.assign(prefix);
+            apply_meta(event, meta);
+
+            disruptor_.sequencer().publish(seq);
+        }
+
         /**
          * @brief Log with a simple message + prefix
          */
@@ -142,7 +284,7 @@ namespace demiplane::scroll {
             thread_local std::string tl_msg_buf;
             tl_msg_buf.clear();
             tl_msg_buf.append(msg);
-            const auto meta = EventMeta{lvl, loc};
+            const auto meta = EventMeta{lvl, loc, tsc_timestamps_};
 
             const std::int64_t seq = disruptor_.sequencer().next();
             auto& event            = disruptor_.ring_buffer()[seq];
@@ -190,11 +332,32 @@ namespace demiplane::scroll {
                 return *this;
             }
 
+            /// Structured field — attached to the event, not appended to the message text
+            template <typename T>
+            StreamProxy& operator<<(const FieldRef<T>& kv) {
+                fields_.add(kv.key, kv.value);
+                return *this;
+            }
+
+            /// Structured field — attached to the event, not appended to the message text
+            template <typename T>
+            StreamProxy& field(const std::string_view key, const T& value) {
+                fields_.add(key, value);
+                return *this;
+            }
+
+            /// Report calls dropped by a rate-limited call site; appended as " [suppressed N]"
+            constexpr StreamProxy& suppressed(const std::uint64_t count) noexcept {
+                suppressed_ = count;
+                return *this;
+            }
+
             constexpr ~StreamProxy() noexcept {
                 thread_local std::string tl_msg_buf;
                 tl_msg_buf.clear();
                 tl_msg_buf.append(stream_.view());
-                const auto meta = EventMeta{level_, loc_};
+                append_suppressed(tl_msg_buf, suppressed_);
+                const auto meta = EventMeta{level_, loc_, logger_->tsc_timestamps_};
 
                 const std::int64_t seq = logger_->disruptor_.sequencer().next();
                 auto& event            = logger_->disruptor_.ring_buffer()[seq];
@@ -202,6 +365,9 @@ namespace demiplane::scroll {
                 event.message.swap(tl_msg_buf);
                 event.prefix.assign(prefix_.view());
                 apply_meta(event, meta);
+                if (!fields_.empty()) {
+                    event.fields = fields_;  // copy-assign: the slot keeps its buffers warm
+                }
 
                 logger_->disruptor_.sequencer().publish(seq);
             }
@@ -212,6 +378,8 @@ namespace demiplane::scroll {
             std::source_location loc_;
             PrefixNameStorage prefix_;
             std::ostringstream stream_;
+            LogFields fields_;
+            std::uint64_t suppressed_ = 0;
         };
 
         template <typename SourceLocationTp = std::source_location>
@@ -229,18 +397,40 @@ namespace demiplane::scroll {
         void shutdown();
 
         void flush() const {
-            for (const auto& [sink, strand] : sink_slots_) {
+            for (const auto& [sink, strand, channel] : sink_slots_) {
                 boost::asio::post(strand, [sink] { sink->flush(); });
             }
         }
 
+        /**
+         * @brief Crash path: flush sink buffers and write not-yet-consumed ring events to @p fd
+         *
+         * Async-signal-safe (see CrashHandler). Ring events are written unformatted as
+         * "LVL [prefix] message". Runs still in flight to sinks are included, so lines a
+         * sink had already written before the crash may appear twice.
+         */
+        void crash_dump(int fd) const noexcept;
+
+        /// Called by CrashHandler::install(): lets every sink acquire what its crash_flush() needs
+        void prepare_crash_flush() const;
+
     private:
         multithread::DynamicDisruptor<LogEvent> disruptor_;
+        /// Block sinks yet to finish each in-flight run, indexed by the run's last sequence & mask
+        std::vector<std::atomic<std::uint32_t>> pending_acks_;
+        /// Last sequence handed to sinks (read by crash_dump)
+        std::atomic<std::int64_t> dispatched_{-1};
+        /// Producers capture TscClock ticks; the consumer converts them with tsc_calibration_
+        bool tsc_timestamps_;
+        chrono::TscCalibration tsc_calibration_;  // consumer thread only
         std::optional<boost::asio::thread_pool> owned_pool_;
         boost::asio::any_io_executor executor_;
         std::vector<SinkSlot> sink_slots_;
+        std::uint32_t blocking_sinks_ = 0;  // sinks with OverflowPolicy::Block
         std::jthread consumer_thread_;
         std::atomic<bool> running_{false};
+        mutable std::atomic<bool> reopen_requested_{false};  // set from signal handlers
+        std::atomic<bool> sinks_stopped_{false};             // shutdown() finished draining the strands
 
         /**
          * @brief Pre-captured metadata (built outside the CAS critical path)
@@ -252,12 +442,20 @@ namespace demiplane::scroll {
             detail::MetaThread tid;
             detail::MetaProcess pid;
 
-            constexpr EventMeta(const LogLevel lvl, const std::source_location& loc) noexcept
+            constexpr EventMeta(const LogLevel lvl, const std::source_location& loc, const bool tsc) noexcept
                 : level{lvl},
-                  location{loc} {
+                  location{loc},
+                  time_point{tsc ? detail::MetaTimePoint{detail::MetaTimePoint::TscCapture{}}
+                                 : detail::MetaTimePoint{}} {
             }
         };
 
+        static void append_suppressed(std::string& message, const std::uint64_t suppressed) {
+            if (suppressed != 0) {
+                std::format_to(std::back_inserter(message), " [suppressed {}]", suppressed);
+            }
+        }
+
         /**
          * @brief Apply pre-captured metadata to ring buffer slot (minimal critical path)
          */
@@ -268,6 +466,49 @@ namespace demiplane::scroll {
             event.tid             = meta.tid;
             event.pid             = meta.pid;
             event.shutdown_signal = false;
+            event.fields.clear();
+        }
+
+        [[nodiscard]] static bool use_tsc(const LoggerConfig& cfg) noexcept {
+            return cfg.timestamp_source() == LoggerConfig::TimestampSource::Tsc && chrono::TscClock::is_invariant();
+        }
+
+        /**
+         * @brief Wait until the consumer has handed every event published so far to the sinks
+         */
+        void wait_dispatched() const;
+
+        /**
+         * @brief Post Sink::reopen() to every strand (the consumer calls this directly)
+         */
+        std::future<void> post_reopen();
+
+        /**
+         * @brief Run @p change against the slot's sink on its strand (inline once shut down)
+         */
+        template <typename Fn>
+        std::future<void> run_on_strand(const SinkSlot& slot, Fn change) {
+            auto done   = std::make_shared<std::promise<void>>();
+            auto result = done->get_future();
+            if (sinks_stopped_.load(std::memory_order_acquire)) {
+                // Strands no longer run (the owned pool may be joined) and nothing else touches the sinks
+                try {
+                    change(*slot.sink);
+                    done->set_value();
+                } catch (...) {
+                    done->set_exception(std::current_exception());
+                }
+                return result;
+            }
+            boost::asio::post(slot.strand, [sink = slot.sink, change = std::move(change), done]() mutable {
+                try {
+                    change(*sink);
+                    done->set_value();
+                } catch (...) {
+                    done->set_exception(std::current_exception());
+                }
+            });
+            return result;
         }
 
         /**
@@ -275,6 +516,14 @@ namespace demiplane::scroll {
          */
         void consumer_loop();
 
+        /**
+         * @brief Hand slots [first, last] to every sink
+         *
+         * Block sinks get spans over the ring and the last of them to finish releases the
+         * slots; decoupled sinks get a copy in their queue before this returns.
+         */
+        void dispatch(std::int64_t first, std::int64_t last);
+
         /**
          * @brief Create wait strategy based on config
          */
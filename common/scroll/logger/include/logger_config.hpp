@@ -14,6 +14,11 @@ namespace demiplane::scroll {
             Blocking   // Lowest CPU
         };
 
+        enum class TimestampSource {
+            SystemClock,  // system_clock::now() per event on the producer
+            Tsc           // raw cycle counter on the producer, converted to wall time by the consumer
+        };
+
         struct BufferCapacity {
             static constexpr std::size_t Small  = 1024;
             static constexpr std::size_t Medium = 8192;
@@ -48,11 +53,17 @@ namespace demiplane::scroll {
             return pool_size_;
         }
 
+        /// Tsc falls back to SystemClock on CPUs without an invariant TSC
+        [[nodiscard]] constexpr TimestampSource timestamp_source() const noexcept {
+            return timestamp_source_;
+        }
+
         static constexpr auto fields() {
             return std::tuple{
                 serialization::Field<&LoggerConfig::ring_buffer_size_, "ring_buffer_size">{},
                 serialization::Field<&LoggerConfig::pool_size_, "pool_size">{},
                 serialization::Field<&LoggerConfig::wait_strategy_, "wait_strategy">{},
+                serialization::Field<&LoggerConfig::timestamp_source_, "timestamp_source">{},
             };
         }
 
@@ -62,9 +73,10 @@ namespace demiplane::scroll {
         friend class ConfigInterface;
         constexpr LoggerConfig() = default;
 
-        std::size_t ring_buffer_size_ = BufferCapacity::Medium;
-        std::size_t pool_size_        = std::thread::hardware_concurrency();
-        WaitStrategy wait_strategy_   = WaitStrategy::Yielding;
+        std::size_t ring_buffer_size_     = BufferCapacity::Medium;
+        std::size_t pool_size_            = std::thread::hardware_concurrency();
+        WaitStrategy wait_strategy_       = WaitStrategy::Yielding;
+        TimestampSource timestamp_source_ = TimestampSource::SystemClock;
     };
 
     class LoggerConfig::Builder {
@@ -95,6 +107,12 @@ namespace demiplane::scroll {
             return std::forward<Self>(self);
         }
 
+        template <typename Self>
+        constexpr auto&& timestamp_source(this Self&& self, const TimestampSource value) noexcept {
+            self.config_.timestamp_source_ = value;
+            return std::forward<Self>(self);
+        }
+
         [[nodiscard]] LoggerConfig finalize() && {
             config_.validate();
             return std::move(config_);
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "sink_interface.hpp"
+#include "sink_options.hpp"
+
+namespace demiplane::scroll {
+    /**
+     * @brief Delivery counters of one sink (Logger::sink_stats())
+     */
+    struct SinkStats {
+        std::uint64_t delivered = 0;  // events the sink has finished processing
+        std::uint64_t dropped   = 0;  // events lost to a full queue (Drop / Summary)
+        std::uint64_t lag       = 0;  // events handed over but not processed yet
+    };
+
+    /**
+     * @brief Per-sink delivery state owned by the Logger
+     *
+     * Always keeps the sink's counters. For Drop / Summary sinks it also owns a
+     * bounded single-producer / single-consumer queue: the logger's consumer
+     * thread copies each run in with enqueue() and the sink's strand empties it
+     * with drain(). Slots are copy-assigned, so message and field buffers stay
+     * allocated across reuse, like the ring's own slots.
+     */
+    class SinkChannel {
+    public:
+        explicit SinkChannel(const SinkOptions& options);
+
+        [[nodiscard]] bool decoupled() const noexcept {
+            return policy_ != SinkOptions::OverflowPolicy::Block;
+        }
+
+        /// Consumer thread, Block sinks: @p count events were posted to the strand
+        void note_dispatched(const std::size_t count) noexcept {
+            dispatched_.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        /// Sink strand: @p count events went through process_batch()
+        void note_delivered(const std::size_t count) noexcept {
+            delivered_.fetch_add(count, std::memory_order_release);
+        }
+
+        /**
+         * @brief Consumer thread: copy as much of @p run as fits, drop and count the rest
+         * @return true if the caller must post drain() to the sink's strand
+         */
+        [[nodiscard]] bool enqueue(std::span<const LogEvent> run);
+
+        /**
+         * @brief Sink strand: hand everything queued to @p sink, then any drop summary
+         */
+        void drain(Sink& sink);
+
+        [[nodiscard]] SinkStats stats() const noexcept;
+
+    private:
+        SinkOptions::OverflowPolicy policy_;
+        std::vector<LogEvent> slots_;
+
+        std::atomic<std::uint64_t> head_{0};  // next slot drain() reads
+        std::atomic<std::uint64_t> tail_{0};  // next slot enqueue() writes
+        std::atomic<bool> draining_{false};   // a drain() is posted or running
+
+        std::atomic<std::uint64_t> dispatched_{0};
+        std::atomic<std::uint64_t> delivered_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint64_t> unreported_{0};  // dropped since the last summary
+        LogEvent summary_;                          // strand only
+
+        [[nodiscard]] bool idle() const noexcept;
+    };
+}  // namespace demiplane::scroll
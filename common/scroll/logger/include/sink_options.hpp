@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+
+#include <config_interface.hpp>
+#include <json/json.hpp>
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Per-sink delivery settings passed to Logger::add_sink()
+     */
+    class SinkOptions final : public serialization::ConfigInterface<SinkOptions, Json::Value> {
+    public:
+        enum class OverflowPolicy {
+            Block,   // read ring slots in place; a slow sink back-pressures producers (default)
+            Drop,    // private bounded queue; events that do not fit are dropped and counted
+            Summary  // as Drop, plus one "dropped N events" warning once the sink catches up
+        };
+
+        // Full constructor (escape hatch)
+        constexpr SinkOptions(const OverflowPolicy overflow_policy, const std::size_t queue_capacity)
+            : overflow_policy_{overflow_policy},
+              queue_capacity_{queue_capacity} {
+        }
+
+        constexpr void validate() const override {
+            if (overflow_policy_ != OverflowPolicy::Block && queue_capacity_ == 0) {
+                throw std::invalid_argument("Sink queue capacity must be positive for Drop / Summary policies");
+            }
+        }
+
+        [[nodiscard]] constexpr OverflowPolicy overflow_policy() const noexcept {
+            return overflow_policy_;
+        }
+
+        /// Events held for the sink beyond the ring (unused for Block)
+        [[nodiscard]] constexpr std::size_t queue_capacity() const noexcept {
+            return queue_capacity_;
+        }
+
+        [[nodiscard]] constexpr bool decoupled() const noexcept {
+            return overflow_policy_ != OverflowPolicy::Block;
+        }
+
+        static constexpr auto fields() {
+            return std::tuple{
+                serialization::Field<&SinkOptions::overflow_policy_, "overflow_policy">{},
+                serialization::Field<&SinkOptions::queue_capacity_, "queue_capacity">{},
+            };
+        }
+
+        class Builder;
+
+    private:
+        friend class ConfigInterface;
+        constexpr SinkOptions() = default;
+
+        OverflowPolicy overflow_policy_ = OverflowPolicy::Block;
+        std::size_t queue_capacity_     = 4096;
+    };
+
+    class SinkOptions::Builder {
+    public:
+        Builder() = default;
+        explicit Builder(const SinkOptions& existing)
+            : config_{existing} {
+        }
+        explicit Builder(SinkOptions&& existing)
+            : config_{std::move(existing)} {
+        }
+
+        template <typename Self>
+        constexpr auto&& overflow_policy(this Self&& self, const OverflowPolicy value) noexcept {
+            self.config_.overflow_policy_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& queue_capacity(this Self&& self, const std::size_t value) noexcept {
+            self.config_.queue_capacity_ = value;
+            return std::forward<Self>(self);
+        }
+
+        [[nodiscard]] SinkOptions finalize() && {
+            config_.validate();
+            return std::move(config_);
+        }
+
+    private:
+        friend class SinkOptions;
+        friend class ConfigInterface;
+        SinkOptions config_;
+    };
+
+}  // namespace demiplane::scroll
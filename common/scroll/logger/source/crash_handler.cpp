@@ -0,0 +1,194 @@
+#include "crash_handler.hpp"
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <tuple>
+
+#if __has_include(<execinfo.h>)
+    #include <execinfo.h>
+    #define DMP_SCROLL_HAS_EXECINFO 1
+#endif
+
+#include "logger.hpp"
+
+namespace demiplane::scroll {
+    namespace {
+        constexpr std::array handled_signals{SIGSEGV, SIGABRT, SIGBUS};
+        constexpr int max_backtrace_frames = 64;
+
+        std::array<std::atomic<const Logger*>, CrashHandler::max_loggers> registered_loggers{};
+        std::array<struct sigaction, handled_signals.size()> previous_actions{};
+        std::atomic<int> crash_fd{STDERR_FILENO};
+        std::atomic<bool> handlers_installed{false};
+        std::atomic<bool> handling_crash{false};
+
+        struct sigaction previous_reopen_action{};
+        std::atomic<int> reopen_signal{0};  // 0: not installed
+
+        // A stack overflow leaves no room to run the handler on the faulting stack
+        alignas(16) char alt_stack[64 * 1024];
+
+        [[nodiscard]] std::string_view signal_name(const int sig) noexcept {
+            switch (sig) {
+                case SIGSEGV:
+                    return "SIGSEGV";
+                case SIGABRT:
+                    return "SIGABRT";
+                case SIGBUS:
+                    return "SIGBUS";
+                default:
+                    return "signal";
+            }
+        }
+
+        void restore_previous(const int sig) noexcept {
+            for (std::size_t i = 0; i < handled_signals.size(); ++i) {
+                if (handled_signals[i] == sig) {
+                    ::sigaction(sig, &previous_actions[i], nullptr);
+                }
+            }
+        }
+
+        void crash_signal_handler(const int sig, siginfo_t*, void*) {
+            // A fault inside the dump itself must not recurse — fall through to re-raise
+            if (!handling_crash.exchange(true, std::memory_order_acq_rel)) {
+                const int fd = crash_fd.load(std::memory_order_relaxed);
+                detail::write_raw(fd, "\n*** scroll: fatal ");
+                detail::write_raw(fd, signal_name(sig));
+                detail::write_raw(fd, ", dumping buffered log output ***\n");
+                CrashHandler::dump(fd);
+            }
+
+            restore_previous(sig);
+            // Blocked until the handler returns; SIGSEGV/SIGBUS also re-fault on return
+            ::raise(sig);
+        }
+
+        void reopen_signal_handler(int /*sig*/) {
+            for (const auto& slot : registered_loggers) {
+                if (const Logger* logger = slot.load(std::memory_order_acquire)) {
+                    logger->request_reopen();
+                }
+            }
+        }
+    }  // namespace
+
+    namespace detail {
+        void write_raw(const int fd, const std::string_view data) noexcept {
+            const char* ptr       = data.data();
+            std::size_t remaining = data.size();
+            while (remaining != 0) {
+                const ssize_t written = ::write(fd, ptr, remaining);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return;
+                }
+                ptr += written;
+                remaining -= static_cast<std::size_t>(written);
+            }
+        }
+    }  // namespace detail
+
+    void CrashHandler::install(const int fd) {
+        crash_fd.store(fd, std::memory_order_relaxed);
+        if (handlers_installed.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+
+#if defined(DMP_SCROLL_HAS_EXECINFO)
+        // First backtrace() call loads libgcc_s (allocates) — do it now, not in the handler
+        std::array<void*, 1> warmup{};
+        std::ignore = ::backtrace(warmup.data(), static_cast<int>(warmup.size()));
+#endif
+
+        // Sinks open what crash_flush() writes through only now, so loggers without a handler don't pay for it
+        for (const auto& slot : registered_loggers) {
+            if (const Logger* logger = slot.load(std::memory_order_acquire)) {
+                logger->prepare_crash_flush();
+            }
+        }
+
+        stack_t stack{};
+        stack.ss_sp    = alt_stack;
+        stack.ss_size  = sizeof(alt_stack);
+        stack.ss_flags = 0;
+        ::sigaltstack(&stack, nullptr);
+
+        struct sigaction action{};
+        action.sa_sigaction = crash_signal_handler;
+        action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+        sigemptyset(&action.sa_mask);
+
+        for (std::size_t i = 0; i < handled_signals.size(); ++i) {
+            ::sigaction(handled_signals[i], &action, &previous_actions[i]);
+        }
+    }
+
+    void CrashHandler::uninstall() noexcept {
+        if (!handlers_installed.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        for (std::size_t i = 0; i < handled_signals.size(); ++i) {
+            ::sigaction(handled_signals[i], &previous_actions[i], nullptr);
+        }
+    }
+
+    bool CrashHandler::installed() noexcept {
+        return handlers_installed.load(std::memory_order_acquire);
+    }
+
+    void CrashHandler::register_logger(const Logger* logger) noexcept {
+        for (auto& slot : registered_loggers) {
+            const Logger* expected = nullptr;
+            if (slot.compare_exchange_strong(expected, logger, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    void CrashHandler::unregister_logger(const Logger* logger) noexcept {
+        for (auto& slot : registered_loggers) {
+            const Logger* expected = logger;
+            if (slot.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+    }
+
+    void CrashHandler::dump(const int fd) noexcept {
+        for (const auto& slot : registered_loggers) {
+            if (const Logger* logger = slot.load(std::memory_order_acquire)) {
+                logger->crash_dump(fd);
+            }
+        }
+
+#if defined(DMP_SCROLL_HAS_EXECINFO)
+        std::array<void*, max_backtrace_frames> frames{};
+        const int depth = ::backtrace(frames.data(), static_cast<int>(frames.size()));
+        detail::write_raw(fd, "*** backtrace ***\n");
+        ::backtrace_symbols_fd(frames.data(), depth, fd);
+#endif
+    }
+
+    void ReopenSignal::install(const int sig) {
+        uninstall();
+
+        struct sigaction action{};
+        action.sa_handler = reopen_signal_handler;
+        action.sa_flags   = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+
+        ::sigaction(sig, &action, &previous_reopen_action);
+        reopen_signal.store(sig, std::memory_order_release);
+    }
+
+    void ReopenSignal::uninstall() noexcept {
+        if (const int sig = reopen_signal.exchange(0, std::memory_order_acq_rel); sig != 0) {
+            ::sigaction(sig, &previous_reopen_action, nullptr);
+        }
+    }
+}  // namespace demiplane::scroll
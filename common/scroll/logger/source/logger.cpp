@@ -1,5 +1,7 @@
 #include "logger.hpp"
 
+#include <mutex>
+
 #include "console_sink.hpp"
 #include "light_entry.hpp"
 
@@ -26,7 +28,7 @@ namespace demiplane::scroll {
             std::atomic<std::size_t> remaining{sink_slots_.size()};
             std::promise<void> done;
 
-            for (auto& [sink, strand] : sink_slots_) {
+            for (auto& [sink, strand, channel] : sink_slots_) {
                 boost::asio::post(strand, [&sink, &remaining, &done] {
                     sink->flush();
                     if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
@@ -42,52 +44,188 @@ namespace demiplane::scroll {
         if (owned_pool_) {
             owned_pool_->join();
         }
+        sinks_stopped_.store(true, std::memory_order_release);
 
         running_.store(false, std::memory_order_release);
     }
     void Logger::consumer_loop() {
+        auto& sequencer       = disruptor_.sequencer();
         std::int64_t next_seq = 0;
         while (running_.load(std::memory_order_acquire)) {
-            const std::int64_t available =
-                disruptor_.sequencer().get_highest_published(next_seq, disruptor_.sequencer().get_cursor());
+            const std::int64_t available = sequencer.get_highest_published(next_seq, sequencer.get_cursor());
+
+            // Logrotate's SIGHUP: reopen ahead of the next run, so that run goes to the new files
+            if (reopen_requested_.load(std::memory_order_relaxed) &&
+                reopen_requested_.exchange(false, std::memory_order_acq_rel)) {
+                std::ignore = post_reopen();
+            }
 
             if (available < next_seq) {
                 // Nothing published yet — back off using the configured wait strategy
                 // (BusySpin / Yielding / Blocking) instead of tight-spinning
-                std::ignore = disruptor_.sequencer().wait_for(next_seq);
+                std::ignore = sequencer.wait_for(next_seq);
                 continue;
             }
 
-            // Collect batch: move all available events out of ring buffer
-            auto batch = std::make_shared<std::vector<LogEvent>>();
-            batch->reserve(static_cast<std::size_t>(available - next_seq + 1));
+            if (tsc_timestamps_) {
+                std::ignore = tsc_calibration_.refresh();
+            }
 
-            std::int64_t last_consumed = next_seq - 1;
+            // Take the run without copying the events — sinks read them in place.
+            // Clearing the available flags is safe here: producers cannot reclaim a
+            // slot before the gating sequence passes it, which only the sinks do.
+            std::int64_t last = next_seq - 1;
             for (std::int64_t seq = next_seq; seq <= available; ++seq) {
+                sequencer.mark_consumed(seq);
                 auto& event = disruptor_.ring_buffer()[seq];
-
                 if (event.shutdown_signal) {
-                    disruptor_.sequencer().mark_consumed(seq);
-                    last_consumed = seq;
                     running_.store(false, std::memory_order_release);
                     break;
                 }
+                if (tsc_timestamps_) {
+                    event.time_point.resolve(tsc_calibration_);
+                }
+                last = seq;
+            }
+
+            if (last >= next_seq) {
+                dispatch(next_seq, last);
+            }
+            next_seq = last + 1;
+        }
+    }
+
+    void Logger::dispatch(const std::int64_t first, const std::int64_t last) {
+        auto& sequencer = disruptor_.sequencer();
+        dispatched_.store(last, std::memory_order_release);
 
-                batch->emplace_back(std::move(event));
-                disruptor_.sequencer().mark_consumed(seq);
-                last_consumed = seq;
+        // At most two segments: the run may wrap past the physical end of the ring
+        const auto& ring = disruptor_.ring_buffer();
+        const auto head  = ring.contiguous(first, last);
+        const auto tail  = ring.contiguous(first + static_cast<std::int64_t>(head.size()), last);
+
+        // Decoupled sinks take a copy now, so they never hold the slots
+        for (auto& [sink, strand, channel] : sink_slots_) {
+            if (!channel->decoupled()) {
+                continue;
+            }
+            const bool post_head = channel->enqueue(head);
+            const bool post_tail = !tail.empty() && channel->enqueue(tail);
+            if (post_head || post_tail) {
+                boost::asio::post(strand, [sink, queue = channel.get()] { queue->drain(*sink); });
             }
+        }
+
+        if (blocking_sinks_ == 0) {
+            sequencer.advance_gating_sequence(last);
+            return;
+        }
 
-            // Bulk gating update — producers see all freed slots at once
-            disruptor_.sequencer().update_gating_sequence(last_consumed);
-            next_seq = last_consumed + 1;
+        auto& pending = pending_acks_[static_cast<std::size_t>(last) & (pending_acks_.size() - 1)];
+        pending.store(blocking_sinks_, std::memory_order_relaxed);
 
-            // Post batch to each sink's strand (one post per sink, not per event)
-            if (!batch->empty()) {
-                for (auto& [sink, strand] : sink_slots_) {
-                    boost::asio::post(strand, [sink, batch] { sink->process_batch(batch); });
+        // Runs retire in order: every sink's strand is serial, so when the last sink acks
+        // this run it has already acked all earlier ones
+        const auto count = static_cast<std::size_t>(last - first + 1);
+        for (auto& [sink, strand, channel] : sink_slots_) {
+            if (channel->decoupled()) {
+                continue;
+            }
+            channel->note_dispatched(count);
+            boost::asio::post(strand, [sink, head, tail, last, count, &pending, &sequencer, stats = channel.get()] {
+                sink->process_batch(head);
+                if (!tail.empty()) {
+                    sink->process_batch(tail);
+                }
+                stats->note_delivered(count);
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    sequencer.advance_gating_sequence(last);
                 }
+            });
+        }
+    }
+
+    void Logger::wait_dispatched() const {
+        const std::int64_t published = disruptor_.sequencer().get_cursor();
+        while (dispatched_.load(std::memory_order_acquire) < published && running_.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::future<void> Logger::post_reopen() {
+        struct Pending {
+            std::atomic<std::size_t> remaining;
+            std::promise<void> done;
+            std::mutex mutex;
+            std::exception_ptr error;
+        };
+
+        if (sink_slots_.empty()) {
+            std::promise<void> none;
+            none.set_value();
+            return none.get_future();
+        }
+
+        auto pending = std::make_shared<Pending>();
+        pending->remaining.store(sink_slots_.size(), std::memory_order_relaxed);
+        auto result = pending->done.get_future();
+        for (const auto& slot : sink_slots_) {
+            std::ignore = run_on_strand(slot, [pending](Sink& sink) {
+                try {
+                    sink.reopen();
+                } catch (...) {
+                    std::lock_guard lock{pending->mutex};
+                    if (!pending->error) {
+                        pending->error = std::current_exception();
+                    }
+                }
+                if (pending->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (pending->error) {
+                        pending->done.set_exception(pending->error);
+                    } else {
+                        pending->done.set_value();
+                    }
+                }
+            });
+        }
+        return result;
+    }
+
+    void Logger::prepare_crash_flush() const {
+        for (const auto& slot : sink_slots_) {
+            slot.sink->prepare_crash_flush();
+        }
+    }
+
+    void Logger::crash_dump(const int fd) const noexcept {
+        // Sink buffers hold older lines than the ring — let them go first
+        for (const auto& slot : sink_slots_) {
+            slot.sink->crash_flush();
+        }
+
+        const auto& sequencer         = disruptor_.sequencer();
+        const std::int64_t cursor     = sequencer.get_cursor();
+        const std::int64_t dispatched = dispatched_.load(std::memory_order_acquire);
+        for (std::int64_t seq = sequencer.get_gating_sequence() + 1; seq <= cursor; ++seq) {
+            // Up to `dispatched` the slots are in flight to sinks and still intact;
+            // past it, skip what a producer has claimed but not yet published
+            if (seq > dispatched && !sequencer.is_available(seq)) {
+                continue;
+            }
+            const auto& event = disruptor_.ring_buffer()[seq];
+            if (event.shutdown_signal) {
+                continue;
+            }
+
+            detail::write_raw(fd, log_level_to_string(event.level));
+            detail::write_raw(fd, " ");
+            if (const auto prefix = event.prefix.view(); !prefix.empty()) {
+                detail::write_raw(fd, "[");
+                detail::write_raw(fd, prefix);
+                detail::write_raw(fd, "] ");
             }
+            detail::write_raw(fd, event.message);
+            detail::write_raw(fd, "\n");
         }
     }
 }  // namespace demiplane::scroll
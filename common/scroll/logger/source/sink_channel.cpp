@@ -0,0 +1,84 @@
+#include "sink_channel.hpp"
+
+#include <algorithm>
+#include <format>
+
+namespace demiplane::scroll {
+    SinkChannel::SinkChannel(const SinkOptions& options)
+        : policy_{options.overflow_policy()} {
+        if (decoupled()) {
+            slots_.resize(options.queue_capacity());
+        }
+    }
+
+    bool SinkChannel::enqueue(const std::span<const LogEvent> run) {
+        const std::uint64_t capacity = slots_.size();
+        const std::uint64_t tail     = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t free     = capacity - (tail - head_.load(std::memory_order_acquire));
+        const std::size_t accepted   = std::min<std::size_t>(run.size(), free);
+
+        for (std::size_t i = 0; i < accepted; ++i) {
+            slots_[(tail + i) % capacity] = run[i];
+        }
+        dispatched_.fetch_add(accepted, std::memory_order_relaxed);
+
+        if (const std::size_t lost = run.size() - accepted; lost != 0) {
+            dropped_.fetch_add(lost, std::memory_order_relaxed);
+            if (policy_ == SinkOptions::OverflowPolicy::Summary) {
+                unreported_.fetch_add(lost);
+            }
+        }
+
+        // seq_cst pairs with drain()'s final check: either it sees the new tail, or we
+        // see draining_ cleared and post a fresh drain
+        tail_.store(tail + accepted);
+        return !draining_.exchange(true);
+    }
+
+    void SinkChannel::drain(Sink& sink) {
+        const std::uint64_t capacity = slots_.size();
+        do {
+            std::uint64_t head = head_.load(std::memory_order_relaxed);
+            for (std::uint64_t tail = tail_.load(std::memory_order_acquire); head != tail;) {
+                const std::uint64_t begin = head % capacity;
+                const std::uint64_t count = std::min(tail - head, capacity - begin);
+                sink.process_batch(std::span<const LogEvent>{slots_.data() + begin, count});
+                head += count;
+                head_.store(head, std::memory_order_release);
+                note_delivered(count);
+            }
+
+            if (const std::uint64_t lost = unreported_.exchange(0); lost != 0) {
+                summary_.level = LogLevel::Warning;
+                summary_.message.clear();
+                std::format_to(std::back_inserter(summary_.message),
+                               "scroll: sink queue overflowed, dropped {} events",
+                               lost);
+                summary_.location   = detail::MetaSource{std::source_location::current()};
+                summary_.time_point = detail::MetaTimePoint{};
+                summary_.tid        = detail::MetaThread{};
+                summary_.pid        = detail::MetaProcess{};
+                if (sink.should_log(summary_.level, summary_.prefix.view())) {
+                    sink.process(summary_);
+                }
+            }
+
+            draining_.store(false);
+            // An enqueue() that saw draining_ still set relies on this pass to pick its events up
+        } while (!idle() && !draining_.exchange(true));
+    }
+
+    bool SinkChannel::idle() const noexcept {
+        return head_.load(std::memory_order_relaxed) == tail_.load() && unreported_.load() == 0;
+    }
+
+    SinkStats SinkChannel::stats() const noexcept {
+        const std::uint64_t delivered  = delivered_.load(std::memory_order_acquire);
+        const std::uint64_t dispatched = dispatched_.load(std::memory_order_relaxed);
+        return SinkStats{
+            .delivered = delivered,
+            .dropped   = dropped_.load(std::memory_order_relaxed),
+            .lag       = dispatched > delivered ? dispatched - delivered : 0,
+        };
+    }
+}  // namespace demiplane::scroll
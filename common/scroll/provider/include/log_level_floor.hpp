@@ -0,0 +1,98 @@
+#pragma once
+
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include <log_level.hpp>
+
+// Lowest level compiled in, as a LogLevel value (0 = Trace ... 5 = Fatal)
+#ifndef DMP_SCROLL_MIN_LEVEL
+    #define DMP_SCROLL_MIN_LEVEL 0
+#endif
+
+// Per-component overrides, keyed by SCROLL_COMPONENT_PREFIX name: "AsyncExecutor=Info,RouteRegistry=Warning"
+#ifndef DMP_SCROLL_COMPONENT_LEVELS
+    #define DMP_SCROLL_COMPONENT_LEVELS ""
+#endif
+
+static_assert(DMP_SCROLL_MIN_LEVEL >= 0 && DMP_SCROLL_MIN_LEVEL <= 5,
+              "DMP_SCROLL_MIN_LEVEL must be 0 (Trace) .. 5 (Fatal)");
+
+namespace demiplane::scroll {
+    /**
+     * @brief Build-wide floor: LOG_* / LOG_DIRECT_* calls below it are compiled out
+     */
+    inline constexpr auto compiled_min_level = static_cast<LogLevel>(DMP_SCROLL_MIN_LEVEL);
+
+    [[nodiscard]] constexpr bool level_compiled_in(const LogLevel lvl,
+                                                   const LogLevel floor = compiled_min_level) noexcept {
+        return static_cast<int>(lvl) >= static_cast<int>(floor);
+    }
+
+    namespace detail {
+        [[nodiscard]] consteval std::string_view trim_spaces(std::string_view text) {
+            while (!text.empty() && text.front() == ' ') {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && text.back() == ' ') {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        [[nodiscard]] consteval LogLevel parse_level_name(const std::string_view name) {
+            constexpr std::string_view long_names[]  = {"Trace", "Debug", "Info", "Warning", "Error", "Fatal"};
+            constexpr std::string_view short_names[] = {"TRC", "DBG", "INF", "WRN", "ERR", "FAT"};
+            for (int i = 0; i < 6; ++i) {
+                if (name == long_names[i] || name == short_names[i]) {
+                    return static_cast<LogLevel>(i);
+                }
+            }
+            throw std::invalid_argument{"DMP_SCROLL_COMPONENT_LEVELS: unknown log level"};
+        }
+    }  // namespace detail
+
+    /**
+     * @brief Compile-time floor of a SCROLL_COMPONENT_PREFIX component
+     * @param component Component prefix name
+     * @param declared Floor written next to the prefix in the source (never below compiled_min_level)
+     * @param table "Name=Level,..." — an entry for @p component wins over both
+     *
+     * A malformed table is a compile error in every component.
+     */
+    [[nodiscard]] consteval LogLevel component_min_level(const std::string_view component,
+                                                         const LogLevel declared = compiled_min_level,
+                                                         std::string_view table = DMP_SCROLL_COMPONENT_LEVELS) {
+        std::optional<LogLevel> configured;
+        while (!table.empty()) {
+            const auto comma = table.find(',');
+            const auto entry = table.substr(0, comma);
+            table            = comma == std::string_view::npos ? std::string_view{} : table.substr(comma + 1);
+            const auto eq    = entry.find('=');
+            if (eq == std::string_view::npos) {
+                throw std::invalid_argument{"DMP_SCROLL_COMPONENT_LEVELS: expected Name=Level"};
+            }
+            const auto level = detail::parse_level_name(detail::trim_spaces(entry.substr(eq + 1)));
+            if (detail::trim_spaces(entry.substr(0, eq)) == component) {
+                configured = level;
+            }
+        }
+        if (configured) {
+            return *configured;
+        }
+        return level_compiled_in(declared) ? declared : compiled_min_level;
+    }
+
+    /**
+     * @brief Turns `stream << a << b` into void so a compiled-out branch can sit in a ?:
+     *
+     * `&` binds looser than `<<`, so the whole chain ends up as the operand.
+     */
+    struct LogVoidify {
+        template <typename T>
+        constexpr void operator&(T&& /*stream*/) const noexcept {
+        }
+    };
+}  // namespace demiplane::scroll
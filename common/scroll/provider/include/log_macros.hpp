@@ -2,6 +2,9 @@
 
 #include <gears_macros.hpp>
 
+#include "log_level_floor.hpp"
+#include "log_rate_limit.hpp"
+
 namespace demiplane::scroll {
     // Dummy stream for disabled logging
     class DummyStream {
@@ -25,8 +28,15 @@ namespace demiplane::scroll {
 //
 // The IIFE initializer runs at compile time; oversized names trigger the
 // consteval-throw path in InlineString::assign → compile error.
+//
+// An optional second argument is the component's compile-time floor —
+// COMPONENT_LOG_* below it compile to nothing:
+//     SCROLL_COMPONENT_PREFIX("RouteRegistry", ::demiplane::scroll::LogLevel::Debug);
+// A DMP_SCROLL_COMPONENT_LEVELS entry for the name overrides it.
 // ============================================================================
-#define SCROLL_COMPONENT_PREFIX(name)                                                                                  \
+#define SCROLL_COMPONENT_PREFIX(name, ...)                                                                             \
+    static constexpr ::demiplane::scroll::LogLevel _dmp_scroll_class_min_level =                                       \
+        ::demiplane::scroll::component_min_level(::std::string_view{name} __VA_OPT__(, ) __VA_ARGS__);                 \
     static constexpr ::demiplane::scroll::PrefixNameStorage _dmp_scroll_class_prefix = [] {                            \
         ::demiplane::scroll::PrefixNameStorage s;                                                                      \
         s.assign(::std::string_view{name});                                                                            \
@@ -39,12 +49,30 @@ namespace demiplane::scroll {
 // ============================================================================
 #define SCROLL_SET_LOGGER_PREFIX(name) this->set_prefix(::std::string_view{name})
 
+// ============================================================================
+// Compile-time level gates. A call below the floor becomes the dead arm of a
+// constant ?: (a bool_constant, so even -O0 emits nothing) — no StreamProxy,
+// no formatting, arguments never evaluated:
+//     COMPONENT_LOG_TRC() << SCROLL_PARAMS(sql);
+//  →  !level_compiled_in(Trace, floor) ? (void)0 : LogVoidify{} & stream(...) << SCROLL_PARAMS(sql);
+// LOG_* / LOG_DIRECT_* use DMP_SCROLL_MIN_LEVEL, COMPONENT_LOG_* the class floor
+// from SCROLL_COMPONENT_PREFIX. Being an expression, the gate leaves if / else
+// around a log statement unaffected.
+// ============================================================================
+#define SCROLL_COMPILED_IN_(level, floor)                                                                              \
+    ::std::bool_constant<::demiplane::scroll::level_compiled_in(level, floor)>::value
+#define SCROLL_GATE_(level, floor) !SCROLL_COMPILED_IN_(level, floor) ? (void)0 :
+#define SCROLL_STREAM_GATE_(level, floor) SCROLL_GATE_(level, floor) ::demiplane::scroll::LogVoidify{} &
+#define SCROLL_GLOBAL_FLOOR_ ::demiplane::scroll::compiled_min_level
+
 #ifdef DMP_ENABLE_LOGGING
    // ========== LOG_* (LoggerProvider path) ==========
     #define LOG_TRC_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_)                                \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Trace, this->prefix().view(), std::source_location::current())
     #define LOG_TRC_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_)                                       \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Trace,                                                  \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -55,9 +83,11 @@ namespace demiplane::scroll {
     #define LOG_TRC(...) CONCAT(LOG_TRC_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     #define LOG_DBG_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_)                                \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Debug, this->prefix().view(), std::source_location::current())
     #define LOG_DBG_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_)                                       \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Debug,                                                  \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -68,9 +98,11 @@ namespace demiplane::scroll {
     #define LOG_DBG(...) CONCAT(LOG_DBG_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     #define LOG_INF_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_)                                 \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Info, this->prefix().view(), std::source_location::current())
     #define LOG_INF_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_)                                        \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Info,                                                   \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -81,9 +113,11 @@ namespace demiplane::scroll {
     #define LOG_INF(...) CONCAT(LOG_INF_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     #define LOG_WRN_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_)                              \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Warning, this->prefix().view(), std::source_location::current())
     #define LOG_WRN_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_)                                     \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Warning,                                                \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -94,9 +128,11 @@ namespace demiplane::scroll {
     #define LOG_WRN(...) CONCAT(LOG_WRN_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     #define LOG_ERR_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_)                                \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Error, this->prefix().view(), std::source_location::current())
     #define LOG_ERR_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_)                                       \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Error,                                                  \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -107,9 +143,11 @@ namespace demiplane::scroll {
     #define LOG_ERR(...) CONCAT(LOG_ERR_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     #define LOG_FAT_STREAM()                                                                                           \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_)                                \
         this->get_logger()->stream(                                                                                    \
             ::demiplane::scroll::LogLevel::Fatal, this->prefix().view(), std::source_location::current())
     #define LOG_FAT_FMT(fmt, ...)                                                                                      \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_)                                       \
         this->get_logger()->log(::demiplane::scroll::LogLevel::Fatal,                                                  \
                                 this->prefix().view(),                                                                 \
                                 std::source_location::current(),                                                       \
@@ -120,6 +158,8 @@ namespace demiplane::scroll {
     #define LOG_FAT(...) CONCAT(LOG_FAT_DISPATCH_, HAS_ARGS(__VA_ARGS__))(__VA_ARGS__)
 
     // ========== ONCE GUARDS ==========
+    // Statement macros end in `if (!emit) {} else <log call>`: the inner if owns its else, so an
+    // else after the macro in an unbraced if binds to the caller's if (and -Wdangling-else stays quiet)
     #define SCROLL_ONCE_GUARD_                                                                                         \
         []() -> bool {                                                                                                 \
             static bool f_ = false;                                                                                    \
@@ -133,42 +173,146 @@ namespace demiplane::scroll {
         }()
 
     #define LOG_TRC_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_TRC(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_TRC(__VA_ARGS__)
     #define LOG_DBG_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_DBG(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_DBG(__VA_ARGS__)
     #define LOG_INF_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_INF(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_) &&                        \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_INF(__VA_ARGS__)
     #define LOG_WRN_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_WRN(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_) &&                     \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_WRN(__VA_ARGS__)
     #define LOG_ERR_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_ERR(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_ERR(__VA_ARGS__)
     #define LOG_FAT_ONCE(...)                                                                                          \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        LOG_FAT(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            LOG_FAT(__VA_ARGS__)
 
     #define LOG_TRC_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_TRC(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_TRC(__VA_ARGS__)
     #define LOG_DBG_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_DBG(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_DBG(__VA_ARGS__)
     #define LOG_INF_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_INF(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_) &&                        \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_INF(__VA_ARGS__)
     #define LOG_WRN_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_WRN(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_) &&                     \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_WRN(__VA_ARGS__)
     #define LOG_ERR_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_ERR(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_ERR(__VA_ARGS__)
     #define LOG_FAT_ATOMIC_ONCE(...)                                                                                   \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        LOG_FAT(__VA_ARGS__)
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_) &&                       \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            LOG_FAT(__VA_ARGS__)
+
+    // ========== RATE-LIMITED / SAMPLED ==========
+    // Per-call-site state lives in a function-local static of a unique lambda, like the ONCE guards.
+    // The check is lock-free (fetch_add / CAS) and runs before any formatting; the emitted line
+    // carries " [suppressed N]" for the calls dropped since the previous one. Below the level floor
+    // the guard is never called and the log call never runs; same if/else shape as the ONCE guards.
+    //
+    //     LOG_WRN_EVERY_N(100) << "queue full, dropping " << id;
+    //     LOG_WRN_EVERY_MS(1000, "backend {} unreachable", host);
+    //     LOG_ERR_RATE(5.0, 20, "bad packet from {}", peer);   // 5/s sustained, bursts of 20
+    #define SCROLL_EVERY_N_GUARD_(n)                                                                                   \
+        [](const std::uint64_t n_) noexcept {                                                                          \
+            static ::demiplane::scroll::EveryN state_;                                                                 \
+            return state_.check(n_);                                                                                   \
+        }(n)
+    #define SCROLL_EVERY_MS_GUARD_(ms)                                                                                 \
+        [](const std::chrono::milliseconds interval_) noexcept {                                                       \
+            static ::demiplane::scroll::EveryInterval state_;                                                          \
+            return state_.check(interval_);                                                                            \
+        }(std::chrono::milliseconds{ms})
+    #define SCROLL_RATE_GUARD_(rate, burst)                                                                            \
+        [](const double rate_, const std::uint32_t burst_) noexcept {                                                  \
+            static ::demiplane::scroll::TokenBucket state_;                                                            \
+            return state_.check(rate_, burst_);                                                                        \
+        }(static_cast<double>(rate), static_cast<std::uint32_t>(burst))
+
+    #define SCROLL_SAMPLED_DISPATCH_(level, suppressed_count)                                                          \
+        this->get_logger()                                                                                             \
+            ->stream(level, this->prefix().view(), std::source_location::current())                                    \
+            .suppressed(suppressed_count)
+    #define SCROLL_SAMPLED_DISPATCH_TRUE(level, suppressed_count, fmt, ...)                                            \
+        this->get_logger()->log_sampled(suppressed_count,                                                              \
+                                        level,                                                                         \
+                                        this->prefix().view(),                                                         \
+                                        std::source_location::current(),                                               \
+                                        fmt __VA_OPT__(, ) __VA_ARGS__)
+    #define SCROLL_SAMPLED_(level, guard, ...)                                                                         \
+        if (const ::demiplane::scroll::SampleDecision _dmp_sample =                                                    \
+                SCROLL_COMPILED_IN_(level, SCROLL_GLOBAL_FLOOR_) ? guard : ::demiplane::scroll::SampleDecision{};      \
+            !_dmp_sample) {                                                                                            \
+        } else                                                                                                         \
+            CONCAT(SCROLL_SAMPLED_DISPATCH_, HAS_ARGS(__VA_ARGS__))                                                    \
+            (level, _dmp_sample.suppressed __VA_OPT__(, ) __VA_ARGS__)
+
+    #define LOG_TRC_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Trace, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_TRC_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Trace, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_TRC_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Trace, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
+    #define LOG_DBG_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Debug, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_DBG_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Debug, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_DBG_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Debug, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
+    #define LOG_INF_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Info, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_INF_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Info, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_INF_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Info, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
+    #define LOG_WRN_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Warning, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_WRN_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Warning, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_WRN_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Warning, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
+    #define LOG_ERR_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Error, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_ERR_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Error, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_ERR_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Error, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
+    #define LOG_FAT_EVERY_N(n, ...)                                                                                    \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Fatal, SCROLL_EVERY_N_GUARD_(n), __VA_ARGS__)
+    #define LOG_FAT_EVERY_MS(ms, ...)                                                                                  \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Fatal, SCROLL_EVERY_MS_GUARD_(ms), __VA_ARGS__)
+    #define LOG_FAT_RATE(rate, burst, ...)                                                                             \
+        SCROLL_SAMPLED_(::demiplane::scroll::LogLevel::Fatal, SCROLL_RATE_GUARD_(rate, burst), __VA_ARGS__)
 
 #else
     #define LOG_TRC(...) ::demiplane::scroll::DummyStream()
@@ -191,6 +335,25 @@ namespace demiplane::scroll {
     #define LOG_WRN_ATOMIC_ONCE(...) ::demiplane::scroll::DummyStream()
     #define LOG_ERR_ATOMIC_ONCE(...) ::demiplane::scroll::DummyStream()
     #define LOG_FAT_ATOMIC_ONCE(...) ::demiplane::scroll::DummyStream()
+
+    #define LOG_TRC_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_TRC_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_TRC_RATE(...) ::demiplane::scroll::DummyStream()
+    #define LOG_DBG_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_DBG_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_DBG_RATE(...) ::demiplane::scroll::DummyStream()
+    #define LOG_INF_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_INF_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_INF_RATE(...) ::demiplane::scroll::DummyStream()
+    #define LOG_WRN_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_WRN_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_WRN_RATE(...) ::demiplane::scroll::DummyStream()
+    #define LOG_ERR_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_ERR_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_ERR_RATE(...) ::demiplane::scroll::DummyStream()
+    #define LOG_FAT_EVERY_N(...) ::demiplane::scroll::DummyStream()
+    #define LOG_FAT_EVERY_MS(...) ::demiplane::scroll::DummyStream()
+    #define LOG_FAT_RATE(...) ::demiplane::scroll::DummyStream()
 #endif
 
 // ============================================================================
@@ -205,29 +368,41 @@ namespace demiplane::scroll {
         (logger_ptr)->stream(level, prefix, std::source_location::current())
 
     #define LOG_DIRECT_FMT_TRC(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_)                                       \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Trace, prefix, fmt, __VA_ARGS__)
     #define LOG_DIRECT_FMT_DBG(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_)                                       \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Debug, prefix, fmt, __VA_ARGS__)
     #define LOG_DIRECT_FMT_INF(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_)                                        \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Info, prefix, fmt, __VA_ARGS__)
     #define LOG_DIRECT_FMT_WRN(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_)                                     \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Warning, prefix, fmt, __VA_ARGS__)
     #define LOG_DIRECT_FMT_ERR(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_)                                       \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Error, prefix, fmt, __VA_ARGS__)
     #define LOG_DIRECT_FMT_FAT(logger_ptr, prefix, fmt, ...)                                                           \
+        SCROLL_GATE_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_)                                       \
         LOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Fatal, prefix, fmt, __VA_ARGS__)
 
     #define LOG_DIRECT_STREAM_TRC(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Trace, SCROLL_GLOBAL_FLOOR_)                                \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Trace, prefix)
     #define LOG_DIRECT_STREAM_DBG(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Debug, SCROLL_GLOBAL_FLOOR_)                                \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Debug, prefix)
     #define LOG_DIRECT_STREAM_INF(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Info, SCROLL_GLOBAL_FLOOR_)                                 \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Info, prefix)
     #define LOG_DIRECT_STREAM_WRN(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Warning, SCROLL_GLOBAL_FLOOR_)                              \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Warning, prefix)
     #define LOG_DIRECT_STREAM_ERR(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Error, SCROLL_GLOBAL_FLOOR_)                                \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Error, prefix)
     #define LOG_DIRECT_STREAM_FAT(logger_ptr, prefix)                                                                  \
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Fatal, SCROLL_GLOBAL_FLOOR_)                                \
         SLOG_DIRECT_FMT(logger_ptr, ::demiplane::scroll::LogLevel::Fatal, prefix)
 #else
     #define LOG_DIRECT_FMT(logger_ptr, level, prefix, fmt, ...) ((void)0)
@@ -254,58 +429,100 @@ namespace demiplane::scroll {
 // ============================================================================
 #ifdef DMP_COMPONENT_LOGGING
     #define COMPONENT_LOG_TRC()                                                                                        \
-        LOG_DIRECT_STREAM_TRC(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Trace, _dmp_scroll_class_min_level)                         \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Trace,                                                          \
+                        _dmp_scroll_class_prefix.view())
     #define COMPONENT_LOG_DBG()                                                                                        \
-        LOG_DIRECT_STREAM_DBG(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Debug, _dmp_scroll_class_min_level)                         \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Debug,                                                          \
+                        _dmp_scroll_class_prefix.view())
     #define COMPONENT_LOG_INF()                                                                                        \
-        LOG_DIRECT_STREAM_INF(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Info, _dmp_scroll_class_min_level)                          \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Info,                                                           \
+                        _dmp_scroll_class_prefix.view())
     #define COMPONENT_LOG_WRN()                                                                                        \
-        LOG_DIRECT_STREAM_WRN(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Warning, _dmp_scroll_class_min_level)                       \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Warning,                                                        \
+                        _dmp_scroll_class_prefix.view())
     #define COMPONENT_LOG_ERR()                                                                                        \
-        LOG_DIRECT_STREAM_ERR(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Error, _dmp_scroll_class_min_level)                         \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Error,                                                          \
+                        _dmp_scroll_class_prefix.view())
     #define COMPONENT_LOG_FAT()                                                                                        \
-        LOG_DIRECT_STREAM_FAT(::demiplane::scroll::ComponentLoggerManager::get(), _dmp_scroll_class_prefix.view())
+        SCROLL_STREAM_GATE_(::demiplane::scroll::LogLevel::Fatal, _dmp_scroll_class_min_level)                         \
+        SLOG_DIRECT_FMT(::demiplane::scroll::ComponentLoggerManager::get(),                                            \
+                        ::demiplane::scroll::LogLevel::Fatal,                                                          \
+                        _dmp_scroll_class_prefix.view())
 
     #define COMPONENT_LOG_ENTER_FUNCTION() COMPONENT_LOG_INF() << "Entering function " << __func__
     #define COMPONENT_LOG_LEAVE_FUNCTION() COMPONENT_LOG_INF() << "Leaving function " << __func__
 
     #define COMPONENT_LOG_TRC_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_TRC()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Trace, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_TRC()
     #define COMPONENT_LOG_DBG_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_DBG()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Debug, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_DBG()
     #define COMPONENT_LOG_INF_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_INF()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Info, _dmp_scroll_class_min_level) &&                 \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_INF()
     #define COMPONENT_LOG_WRN_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_WRN()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Warning, _dmp_scroll_class_min_level) &&              \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_WRN()
     #define COMPONENT_LOG_ERR_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_ERR()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Error, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_ERR()
     #define COMPONENT_LOG_FAT_ONCE()                                                                                   \
-        if (SCROLL_ONCE_GUARD_)                                                                                        \
-        COMPONENT_LOG_FAT()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Fatal, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ONCE_GUARD_)) {                                                                                   \
+        } else                                                                                                         \
+            COMPONENT_LOG_FAT()
 
     #define COMPONENT_LOG_TRC_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_TRC()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Trace, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_TRC()
     #define COMPONENT_LOG_DBG_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_DBG()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Debug, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_DBG()
     #define COMPONENT_LOG_INF_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_INF()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Info, _dmp_scroll_class_min_level) &&                 \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_INF()
     #define COMPONENT_LOG_WRN_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_WRN()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Warning, _dmp_scroll_class_min_level) &&              \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_WRN()
     #define COMPONENT_LOG_ERR_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_ERR()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Error, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_ERR()
     #define COMPONENT_LOG_FAT_ATOMIC_ONCE()                                                                            \
-        if (SCROLL_ATOMIC_ONCE_GUARD_)                                                                                 \
-        COMPONENT_LOG_FAT()
+        if (!(SCROLL_COMPILED_IN_(::demiplane::scroll::LogLevel::Fatal, _dmp_scroll_class_min_level) &&                \
+              SCROLL_ATOMIC_ONCE_GUARD_)) {                                                                            \
+        } else                                                                                                         \
+            COMPONENT_LOG_FAT()
 #else
     #define COMPONENT_LOG(level, message) ((void)0)
     #define COMPONENT_LOG_TRC() ::demiplane::scroll::DummyStream()
@@ -32,3 +32,20 @@
         oss << " " << CALL_FMT(COUNT_ARGS(__VA_ARGS__), __VA_ARGS__);                                                  \
         return oss.str();                                                                                              \
     })()
+
+// Structured counterpart of SCROLL_PARAMS: the values travel as typed fields on the
+// event instead of being flattened into the message text
+//     LOG_INF() << "request served" << SCROLL_FIELDS(user_id, latency_ms);
+#define KV_1(p1) ::demiplane::scroll::field(#p1, p1)
+#define KV_2(p1, p2) KV_1(p1) << KV_1(p2)
+#define KV_3(p1, p2, p3) KV_2(p1, p2) << KV_1(p3)
+#define KV_4(p1, p2, p3, p4) KV_3(p1, p2, p3) << KV_1(p4)
+#define KV_5(p1, p2, p3, p4, p5) KV_4(p1, p2, p3, p4) << KV_1(p5)
+#define KV_6(p1, p2, p3, p4, p5, p6) KV_5(p1, p2, p3, p4, p5) << KV_1(p6)
+#define KV_7(p1, p2, p3, p4, p5, p6, p7) KV_6(p1, p2, p3, p4, p5, p6) << KV_1(p7)
+#define KV_8(p1, p2, p3, p4, p5, p6, p7, p8) KV_7(p1, p2, p3, p4, p5, p6, p7) << KV_1(p8)
+
+#define DISPATCH_KV(N) KV_##N
+#define CALL_KV(N, ...) DISPATCH_KV(N)(__VA_ARGS__)
+
+#define SCROLL_FIELDS(...) CALL_KV(COUNT_ARGS(__VA_ARGS__), __VA_ARGS__)
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace demiplane::scroll {
+    /**
+     * @brief Outcome of a per-call-site sampling check
+     *
+     * @c suppressed is the number of calls dropped at this site since the last emitted
+     * one; the macros append it to the emitted line as " [suppressed N]".
+     */
+    struct SampleDecision {
+        bool emit                = false;
+        std::uint64_t suppressed = 0;
+
+        constexpr explicit operator bool() const noexcept {
+            return emit;
+        }
+    };
+
+    namespace detail {
+        [[nodiscard]] inline std::int64_t sample_clock_ns() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+    }  // namespace detail
+
+    /**
+     * @brief Emit the 1st, (n+1)th, (2n+1)th, ... call — one relaxed fetch_add per check
+     */
+    class EveryN {
+    public:
+        [[nodiscard]] SampleDecision check(const std::uint64_t n) noexcept {
+            const std::uint64_t count = counter_.fetch_add(1, std::memory_order_relaxed);
+            if (n <= 1) {
+                return {true, 0};
+            }
+            if (count % n != 0) {
+                return {};
+            }
+            return {true, count == 0 ? 0 : n - 1};
+        }
+
+    private:
+        std::atomic<std::uint64_t> counter_{0};
+    };
+
+    /**
+     * @brief Emit at most once per interval
+     *
+     * Suppressed calls cost a clock read and one relaxed load; only the caller that
+     * wins the CAS on the next deadline emits.
+     */
+    class EveryInterval {
+    public:
+        [[nodiscard]] SampleDecision check(const std::chrono::nanoseconds interval) noexcept {
+            return check(interval, detail::sample_clock_ns());
+        }
+
+        /// @param now_ns Monotonic timestamp in nanoseconds (exposed for tests)
+        [[nodiscard]] SampleDecision check(const std::chrono::nanoseconds interval,
+                                           const std::int64_t now_ns) noexcept {
+            std::int64_t next = next_ns_.load(std::memory_order_relaxed);
+            if (now_ns < next ||
+                !next_ns_.compare_exchange_strong(next, now_ns + interval.count(), std::memory_order_relaxed)) {
+                suppressed_.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+            return {true, suppressed_.exchange(0, std::memory_order_relaxed)};
+        }
+
+    private:
+        std::atomic<std::int64_t> next_ns_{std::numeric_limits<std::int64_t>::min()};
+        std::atomic<std::uint64_t> suppressed_{0};
+    };
+
+    /**
+     * @brief Token bucket (GCRA form): sustained @p rate per second, bursts of up to @p burst
+     *
+     * The whole bucket is one atomic "theoretical arrival time" — a check is a clock
+     * read plus a CAS, no lock and no refill thread.
+     */
+    class TokenBucket {
+    public:
+        [[nodiscard]] SampleDecision check(const double rate, const std::uint32_t burst) noexcept {
+            return check(rate, burst, detail::sample_clock_ns());
+        }
+
+        /// @param now_ns Monotonic timestamp in nanoseconds (exposed for tests)
+        [[nodiscard]] SampleDecision
+        check(const double rate, const std::uint32_t burst, const std::int64_t now_ns) noexcept {
+            if (rate <= 0.0) {
+                suppressed_.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+            const auto emission  = static_cast<std::int64_t>(1e9 / rate);
+            const auto tolerance = emission * static_cast<std::int64_t>(std::max<std::uint32_t>(burst, 1) - 1);
+
+            std::int64_t tat = tat_.load(std::memory_order_relaxed);
+            while (true) {
+                const std::int64_t start = std::max(tat, now_ns);
+                if (start - now_ns > tolerance) {
+                    suppressed_.fetch_add(1, std::memory_order_relaxed);
+                    return {};
+                }
+                if (tat_.compare_exchange_weak(tat, start + emission, std::memory_order_relaxed)) {
+                    return {true, suppressed_.exchange(0, std::memory_order_relaxed)};
+                }
+            }
+        }
+
+    private:
+        std::atomic<std::int64_t> tat_{std::numeric_limits<std::int64_t>::min()};
+        std::atomic<std::uint64_t> suppressed_{0};
+    };
+}  // namespace demiplane::scroll
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+#include "compressed_file_sink_config.hpp"
+#include "zstd_frame_writer.hpp"
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief File sink that compresses entries inline into zstd frames
+     *
+     * @tparam EntryType Defines which metadata to include (e.g., DetailedEntry, LightEntry)
+     *
+     * The file is a sequence of independent zstd frames. A frame is closed when either:
+     * - frame_size uncompressed bytes went into it, or
+     * - frame_interval elapsed since its first entry (checked by a background ticker,
+     *   so a quiet logger still gets its tail onto disk)
+     *
+     * Only closed frames are decodable, so `zstdcat app_<time>.log.zst` on a file that
+     * is still being written shows everything up to the last closed frame.
+     *
+     * Naming follows FileSink: app.log.zst → app.log_2025-01-18T10:30:45.zst
+     * (pick a name like "app.zst" for app_2025-01-18T10:30:45.zst).
+     *
+     * reopen() closes the open frame and the file, then opens the configured path again.
+     */
+    template <detail::EntryConcept EntryType>
+    class CompressedFileSink final : public Sink {
+    public:
+        template <typename CompressedFileSinkConfigTp = CompressedFileSinkConfig>
+            requires std::constructible_from<CompressedFileSinkConfig, CompressedFileSinkConfigTp>
+        explicit CompressedFileSink(CompressedFileSinkConfigTp&& cfg)
+            : config_{std::forward<CompressedFileSinkConfigTp>(cfg)},
+              writer_{config_.compression_level()} {
+            init();
+            if (config_.frame_interval() > std::chrono::milliseconds::zero()) {
+                ticker_ = std::jthread{[this](const std::stop_token& token) { ticker_loop(token); }};
+            }
+        }
+
+        ~CompressedFileSink() override {
+            if (ticker_.joinable()) {
+                ticker_.request_stop();
+                ticker_.join();
+            }
+            std::lock_guard lock{mutex_};
+            writer_.close();
+        }
+
+        void process(const LogEvent& event) override {
+            if (!should_log(event.level, event.prefix.view())) {
+                return;
+            }
+
+            auto entry = make_entry_from_event<EntryType>(event);
+            entry.format_into(format_buffer_);
+
+            std::lock_guard lock{mutex_};
+            const bool frame_was_empty = writer_.frame_bytes() == 0;
+            writer_.write(format_buffer_);
+
+            if (writer_.frame_bytes() >= config_.frame_size()) {
+                writer_.end_frame();
+            } else if (frame_was_empty) {
+                frame_opened_ = std::chrono::steady_clock::now();
+                frame_cv_.notify_one();
+            }
+        }
+
+        /// Close the open frame so everything logged so far is decodable
+        void flush() override {
+            std::lock_guard lock{mutex_};
+            writer_.end_frame();
+        }
+
+        [[nodiscard]] bool should_log(LogLevel lvl, const std::string_view prefix) const noexcept override {
+            return static_cast<int8_t>(lvl) >= static_cast<int8_t>(config_.threshold()) &&
+                   config_.prefix_filter().accepts(prefix);
+        }
+
+        void reopen() override {
+            std::lock_guard lock{mutex_};
+            writer_.close();
+            init();
+        }
+
+        [[nodiscard]] constexpr const CompressedFileSinkConfig& config() const noexcept {
+            return config_;
+        }
+
+        [[nodiscard]] const std::filesystem::path& file_path() const noexcept {
+            return file_path_;
+        }
+
+    private:
+        CompressedFileSinkConfig config_;
+        ZstdFrameWriter writer_;
+        std::filesystem::path file_path_;
+        std::mutex mutex_;
+        std::string format_buffer_;  // Reused across process() calls (no TL dependency)
+
+        std::condition_variable_any frame_cv_;
+        std::chrono::steady_clock::time_point frame_opened_{};
+        std::jthread ticker_;
+
+        void init() {
+            std::filesystem::path full_path = config_.file();
+
+            if (config_.add_time_to_filename()) {
+                const std::string stem             = full_path.stem().string();
+                const std::string ext              = full_path.extension().string();
+                const std::filesystem::path parent = full_path.parent_path();
+                const std::string time = chrono::LocalClock::current_time(config_.time_format_in_file_name());
+                full_path              = parent / (stem + "_" + time + ext);
+            }
+
+            if (!full_path.parent_path().empty()) {
+                std::filesystem::create_directories(full_path.parent_path());
+            }
+
+            writer_.open(full_path);
+            file_path_ = full_path;
+        }
+
+        /**
+         * @brief Closes frames that outlive frame_interval
+         *
+         * Sleeps until a frame is opened, then until its deadline; a frame closed in the
+         * meantime by size or flush() just restarts the wait.
+         */
+        void ticker_loop(const std::stop_token& token) {
+            std::unique_lock lock{mutex_};
+            while (!token.stop_requested()) {
+                if (!frame_cv_.wait(lock, token, [this] { return writer_.frame_bytes() != 0; })) {
+                    return;
+                }
+
+                const auto deadline = frame_opened_ + config_.frame_interval();
+                const auto opened   = frame_opened_;
+                frame_cv_.wait_until(lock, token, deadline, [this, opened] {
+                    return writer_.frame_bytes() == 0 || frame_opened_ != opened;
+                });
+
+                if (writer_.frame_bytes() != 0 && frame_opened_ == opened &&
+                    std::chrono::steady_clock::now() >= deadline) {
+                    try {
+                        writer_.end_frame();
+                    } catch (...) {
+                        // Nowhere to report from the ticker; the next process()/flush() retries
+                    }
+                }
+            }
+        }
+    };
+}  // namespace demiplane::scroll
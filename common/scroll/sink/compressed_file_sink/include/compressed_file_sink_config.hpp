@@ -0,0 +1,184 @@
+#pragma once
+
+#include <chrono>
+#include <demiplane/chrono>
+#include <demiplane/gears>
+#include <filesystem>
+
+#include <config_interface.hpp>
+#include <json/json.hpp>
+#include <prefix_filter.hpp>
+#include <sink_interface.hpp>
+
+namespace demiplane::scroll {
+
+    class CompressedFileSinkConfig final
+        : public serialization::ConfigInterface<CompressedFileSinkConfig, Json::Value> {
+    public:
+        // Full constructor (escape hatch)
+        constexpr CompressedFileSinkConfig(const LogLevel threshold,
+                                           std::filesystem::path file,
+                                           const bool add_time_to_filename,
+                                           std::string time_format_in_file_name,
+                                           const std::int32_t compression_level,
+                                           const std::uint64_t frame_size,
+                                           const std::chrono::milliseconds frame_interval,
+                                           PrefixFilter prefix_filter = {}) noexcept
+            : threshold_{threshold},
+              file_{std::move(file)},
+              add_time_to_filename_{add_time_to_filename},
+              time_format_in_file_name_{std::move(time_format_in_file_name)},
+              compression_level_{compression_level},
+              frame_size_{frame_size},
+              frame_interval_{frame_interval},
+              prefix_filter_{std::move(prefix_filter)} {
+        }
+
+        constexpr void validate() const override {
+            if (file_.empty()) {
+                throw std::invalid_argument("file path must be specified");
+            }
+            if (add_time_to_filename_ && time_format_in_file_name_.empty()) {
+                throw std::invalid_argument("time format must be specified");
+            }
+            if (compression_level_ < 1 || compression_level_ > 19) {
+                throw std::invalid_argument("compression_level must be in [1, 19]");
+            }
+            if (frame_size_ == 0) {
+                throw std::invalid_argument("frame_size must be greater than 0");
+            }
+            if (frame_interval_ < std::chrono::milliseconds::zero()) {
+                throw std::invalid_argument("frame_interval must not be negative");
+            }
+        }
+
+        [[nodiscard]] constexpr LogLevel threshold() const noexcept {
+            return threshold_;
+        }
+        [[nodiscard]] constexpr const std::filesystem::path& file() const noexcept {
+            return file_;
+        }
+        [[nodiscard]] constexpr bool add_time_to_filename() const noexcept {
+            return add_time_to_filename_;
+        }
+        [[nodiscard]] constexpr const std::string& time_format_in_file_name() const noexcept {
+            return time_format_in_file_name_;
+        }
+        [[nodiscard]] constexpr std::int32_t compression_level() const noexcept {
+            return compression_level_;
+        }
+        /// A frame is closed once this many uncompressed bytes went into it
+        [[nodiscard]] constexpr std::uint64_t frame_size() const noexcept {
+            return frame_size_;
+        }
+        /// A non-empty frame is closed at most this long after its first entry (0 = size only)
+        [[nodiscard]] constexpr std::chrono::milliseconds frame_interval() const noexcept {
+            return frame_interval_;
+        }
+        [[nodiscard]] const PrefixFilter& prefix_filter() const noexcept {
+            return prefix_filter_;
+        }
+
+        static constexpr auto fields() {
+            return std::tuple{
+                serialization::Field<&CompressedFileSinkConfig::threshold_, "threshold">{},
+                serialization::Field<&CompressedFileSinkConfig::file_, "file">{},
+                serialization::Field<&CompressedFileSinkConfig::add_time_to_filename_, "add_time_to_filename">{},
+                serialization::Field<&CompressedFileSinkConfig::time_format_in_file_name_,
+                                     "time_format_in_file_name">{},
+                serialization::Field<&CompressedFileSinkConfig::compression_level_, "compression_level">{},
+                serialization::Field<&CompressedFileSinkConfig::frame_size_, "frame_size">{},
+                serialization::Field<&CompressedFileSinkConfig::frame_interval_, "frame_interval">{},
+                serialization::Field<&CompressedFileSinkConfig::prefix_filter_,
+                                     "prefix_filter",
+                                     serialization::FieldPolicy::Excluded>{},
+            };
+        }
+
+        class Builder;
+
+    private:
+        friend class ConfigInterface;
+        constexpr CompressedFileSinkConfig() = default;
+
+        LogLevel threshold_ = LogLevel::Debug;
+        std::filesystem::path file_;
+        bool add_time_to_filename_            = true;
+        std::string time_format_in_file_name_ = chrono::clock_formats::iso8601;
+
+        std::int32_t compression_level_ = 3;
+        std::uint64_t frame_size_       = gears::literals::operator""_kb(64);
+        std::chrono::milliseconds frame_interval_{1000};
+        PrefixFilter prefix_filter_{};
+    };
+
+    class CompressedFileSinkConfig::Builder {
+    public:
+        Builder() = default;
+        explicit Builder(const CompressedFileSinkConfig& existing)
+            : config_{existing} {
+        }
+        explicit Builder(CompressedFileSinkConfig&& existing)
+            : config_{std::move(existing)} {
+        }
+
+        template <typename Self>
+        constexpr auto&& threshold(this Self&& self, const LogLevel value) noexcept {
+            self.config_.threshold_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& file(this Self&& self, std::filesystem::path value) noexcept {
+            self.config_.file_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& add_time_to_filename(this Self&& self, const bool value) noexcept {
+            self.config_.add_time_to_filename_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& time_format_in_file_name(this Self&& self, std::string value) noexcept {
+            self.config_.time_format_in_file_name_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& compression_level(this Self&& self, const std::int32_t value) noexcept {
+            self.config_.compression_level_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& frame_size(this Self&& self, const std::uint64_t value) noexcept {
+            self.config_.frame_size_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& frame_interval(this Self&& self, const std::chrono::milliseconds value) noexcept {
+            self.config_.frame_interval_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& prefix_filter(this Self&& self, PrefixFilter value) noexcept {
+            self.config_.prefix_filter_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        [[nodiscard]] CompressedFileSinkConfig finalize() && {
+            config_.validate();
+            return std::move(config_);
+        }
+
+    private:
+        friend class CompressedFileSinkConfig;
+        friend class ConfigInterface;
+        CompressedFileSinkConfig config_;
+    };
+
+}  // namespace demiplane::scroll
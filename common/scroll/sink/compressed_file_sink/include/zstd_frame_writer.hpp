@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+struct ZSTD_CCtx_s;
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Streams data into a file as a sequence of independent zstd frames
+     *
+     * write() feeds the open frame; end_frame() closes it and hands the bytes to the OS.
+     * A concatenation of complete frames is itself a valid zstd stream, so a file that
+     * is still being written (or whose writer crashed) decodes with `zstdcat` up to the
+     * last ended frame. Existing files are appended to, not truncated.
+     *
+     * Not thread-safe — the owning sink serializes access.
+     */
+    class ZstdFrameWriter {
+    public:
+        explicit ZstdFrameWriter(std::int32_t level);
+        ~ZstdFrameWriter();
+
+        ZstdFrameWriter(const ZstdFrameWriter&)            = delete;
+        ZstdFrameWriter& operator=(const ZstdFrameWriter&) = delete;
+
+        /**
+         * @brief Open (append) the target file, ending any frame in progress first
+         * @throws std::runtime_error if the file cannot be opened
+         */
+        void open(const std::filesystem::path& path);
+
+        /**
+         * @brief Compress @p data into the open frame (starting one if needed)
+         * @throws std::runtime_error on a compression error
+         */
+        void write(std::string_view data);
+
+        /**
+         * @brief Finish the open frame and flush it to the file; no-op when no frame is open
+         * @throws std::runtime_error on a compression error
+         */
+        void end_frame();
+
+        /// End the open frame and close the file
+        void close();
+
+        [[nodiscard]] bool is_open() const noexcept {
+            return out_.is_open();
+        }
+
+        /// Uncompressed bytes fed into the open frame
+        [[nodiscard]] std::size_t frame_bytes() const noexcept {
+            return frame_bytes_;
+        }
+
+        /// Compressed bytes written to the file since open()
+        [[nodiscard]] std::uint64_t bytes_written() const noexcept {
+            return bytes_written_;
+        }
+
+    private:
+        struct CCtxDeleter {
+            void operator()(ZSTD_CCtx_s* ctx) const noexcept;
+        };
+
+        std::unique_ptr<ZSTD_CCtx_s, CCtxDeleter> cctx_;
+        std::ofstream out_;
+        std::vector<char> out_buf_;
+        std::size_t frame_bytes_     = 0;
+        std::uint64_t bytes_written_ = 0;
+
+        void compress(std::string_view data, bool end);
+    };
+
+}  // namespace demiplane::scroll
@@ -0,0 +1,86 @@
+#include "zstd_frame_writer.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include <zstd.h>
+
+namespace demiplane::scroll {
+    void ZstdFrameWriter::CCtxDeleter::operator()(ZSTD_CCtx_s* ctx) const noexcept {
+        ZSTD_freeCCtx(ctx);
+    }
+
+    ZstdFrameWriter::ZstdFrameWriter(const std::int32_t level)
+        : cctx_{ZSTD_createCCtx()},
+          out_buf_(ZSTD_CStreamOutSize()) {
+        if (!cctx_) {
+            throw std::runtime_error{"Failed to create zstd compression context"};
+        }
+        ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_compressionLevel, level);
+        ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_checksumFlag, 1);
+    }
+
+    ZstdFrameWriter::~ZstdFrameWriter() {
+        try {
+            close();
+        } catch (...) {
+            // Destructor must not throw; the unfinished frame is lost
+        }
+    }
+
+    void ZstdFrameWriter::open(const std::filesystem::path& path) {
+        close();
+
+        out_.open(path, std::ios::out | std::ios::binary | std::ios::app);
+        if (!out_.is_open()) {
+            throw std::runtime_error{"Failed to open log file: " + path.string()};
+        }
+        bytes_written_ = 0;
+    }
+
+    void ZstdFrameWriter::write(const std::string_view data) {
+        if (data.empty()) {
+            return;
+        }
+        compress(data, false);
+        frame_bytes_ += data.size();
+    }
+
+    void ZstdFrameWriter::end_frame() {
+        if (frame_bytes_ == 0) {
+            return;
+        }
+        compress({}, true);
+        frame_bytes_ = 0;
+        out_.flush();
+    }
+
+    void ZstdFrameWriter::close() {
+        if (!out_.is_open()) {
+            return;
+        }
+        end_frame();
+        out_.close();
+    }
+
+    void ZstdFrameWriter::compress(const std::string_view data, const bool end) {
+        const ZSTD_EndDirective mode = end ? ZSTD_e_end : ZSTD_e_continue;
+        ZSTD_inBuffer input{data.data(), data.size(), 0};
+
+        bool finished = false;
+        while (!finished) {
+            ZSTD_outBuffer output{out_buf_.data(), out_buf_.size(), 0};
+            const std::size_t remaining = ZSTD_compressStream2(cctx_.get(), &output, &input, mode);
+            if (ZSTD_isError(remaining)) {
+                ZSTD_CCtx_reset(cctx_.get(), ZSTD_reset_session_only);
+                frame_bytes_ = 0;
+                throw std::runtime_error{std::string{"zstd compression failed: "} + ZSTD_getErrorName(remaining)};
+            }
+            if (output.pos != 0) {
+                out_.write(out_buf_.data(), static_cast<std::streamsize>(output.pos));
+                bytes_written_ += output.pos;
+            }
+            finished = end ? remaining == 0 : input.pos == input.size;
+        }
+    }
+}  // namespace demiplane::scroll
@@ -29,7 +29,7 @@ namespace demiplane::scroll {
      *
      */
     template <detail::EntryConcept EntryType>
-    class ConsoleSink final : public Sink {
+    class ConsoleSink final : public Sink, public Reconfigurable<ConsoleSinkConfig> {
     public:
         template <typename ConsoleSinkConfigTp = ConsoleSinkConfig>
             requires std::constructible_from<ConsoleSinkConfig, ConsoleSinkConfigTp>
@@ -68,8 +68,9 @@ namespace demiplane::scroll {
                    config_.prefix_filter().accepts(prefix);
         }
 
-        // Allow runtime config replacement
-        void set_config(ConsoleSinkConfig cfg) noexcept {
+        // Allow runtime config replacement (Logger::reconfigure applies it between batches)
+        void set_config(ConsoleSinkConfig cfg) override {
+            std::lock_guard lock{mutex_};
             config_ = std::move(cfg);
         }
 
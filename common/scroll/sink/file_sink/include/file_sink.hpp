@@ -1,8 +1,14 @@
 #pragma once
 
+#include <cerrno>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "file_sink_config.hpp"
 
@@ -24,15 +30,22 @@ namespace demiplane::scroll {
      *   - app_2025-01-18T10:00:00.log (old file, closed)
      *   - app_2025-01-18T12:30:45.log (new file, active)
      *
+     * With compression / retention configured, closed files are handed to a LogArchiver:
+     * compressed to app_<time>.log.zst and pruned oldest-first on a low-priority
+     * background thread, so rotation itself stays a close + open.
+     *
+     * External rotation (logrotate + SIGHUP): reopen() closes the current file and
+     * opens the configured path again, so writes move to the fresh file.
      */
     template <detail::EntryConcept EntryType>
-    class FileSink final : public Sink {
+    class FileSink final : public Sink, public Reconfigurable<FileSinkConfig> {
     public:
         template <typename FileSinkConfigTp = FileSinkConfig>
             requires std::constructible_from<FileSinkConfig, FileSinkConfigTp>
         explicit FileSink(FileSinkConfigTp&& cfg) noexcept
             : config_{std::forward<FileSinkConfigTp>(cfg)} {
             init();
+            reset_archiver();
         }
 
         ~FileSink() override {
@@ -41,6 +54,7 @@ namespace demiplane::scroll {
                 file_stream_.flush();
                 file_stream_.close();
             }
+            close_crash_fd();
         }
 
         void process(const LogEvent& event) override {
@@ -69,13 +83,67 @@ namespace demiplane::scroll {
             file_stream_.flush();
         }
 
+        /// Appends the unflushed part of the stream buffer through a raw fd (no lock — the owner may be dead)
+        void crash_flush() noexcept override {
+            if (crash_fd_ < 0) {
+                return;
+            }
+            const std::string_view pending = PutArea::pending(*file_stream_.rdbuf());
+            std::size_t offset             = 0;
+            while (offset < pending.size()) {
+                const ssize_t written = ::write(crash_fd_, pending.data() + offset, pending.size() - offset);
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (written <= 0) {
+                    return;
+                }
+                offset += static_cast<std::size_t>(written);
+            }
+        }
+
+        /// Opens the raw fd crash_flush() writes through, now and on every later reopen or rotation
+        void prepare_crash_flush() override {
+            std::lock_guard lock{mutex_};
+            crash_flush_prepared_ = true;
+            open_crash_fd();
+        }
+
         [[nodiscard]] bool should_log(LogLevel lvl, const std::string_view prefix) const noexcept override {
             return static_cast<int8_t>(lvl) >= static_cast<int8_t>(config_.threshold()) &&
                    config_.prefix_filter().accepts(prefix);
         }
 
-        void set_config(FileSinkConfig cfg) noexcept {
-            config_ = std::move(cfg);
+        void reopen() override {
+            std::lock_guard lock{mutex_};
+            file_stream_.flush();
+            file_stream_.close();
+            init();
+        }
+
+        /// Swap the config; a different file or naming scheme flushes the current file and opens the new one
+        void set_config(FileSinkConfig cfg) override {
+            std::lock_guard lock{mutex_};
+            const bool retarget = cfg.file() != config_.file() ||
+                                  cfg.add_time_to_filename() != config_.add_time_to_filename() ||
+                                  cfg.time_format_in_file_name() != config_.time_format_in_file_name();
+            const bool rearchive = retarget || cfg.archive_policy() != config_.archive_policy();
+
+            FileSinkConfig previous = std::exchange(config_, std::move(cfg));
+            if (retarget) {
+                file_stream_.flush();
+                file_stream_.close();
+                try {
+                    init();
+                } catch (...) {
+                    config_ = std::move(previous);
+                    init();
+                    throw;
+                }
+            }
+            if (rearchive) {
+                reset_archiver();  // the old archiver finishes its queue first
+            }
         }
 
         [[nodiscard]] constexpr const FileSinkConfig& config() const noexcept {
@@ -86,6 +154,13 @@ namespace demiplane::scroll {
             return file_path_;
         }
 
+        /// Block until every rotated file has been compressed / pruned (no-op without an archiver)
+        void wait_archived() const {
+            if (archiver_) {
+                archiver_->wait_idle();
+            }
+        }
+
     private:
         FileSinkConfig config_;
         std::ofstream file_stream_;
@@ -93,6 +168,40 @@ namespace demiplane::scroll {
         std::mutex mutex_;
         std::string format_buffer_;                    // Reused across process() calls (no TL dependency)
         alignas(64) char stream_buffer_[64 * 1024]{};  // 64KB static buffer, cache-line aligned
+        std::unique_ptr<LogArchiver> archiver_;        // Null unless compression / retention is configured
+        int crash_fd_              = -1;               // O_APPEND twin of file_stream_ for crash_flush()
+        bool crash_flush_prepared_ = false;            // Set once a CrashHandler is installed; no crash_fd_ before
+
+        /// Exposes the filebuf put area (bytes written to the stream but not yet to the file)
+        struct PutArea : std::filebuf {
+            [[nodiscard]] static std::string_view pending(const std::filebuf& buf) noexcept {
+                constexpr auto base = &PutArea::pbase;
+                constexpr auto ptr  = &PutArea::pptr;
+                const char* begin   = (buf.*base)();
+                return {begin, static_cast<std::size_t>((buf.*ptr)() - begin)};
+            }
+        };
+
+        void close_crash_fd() noexcept {
+            if (crash_fd_ >= 0) {
+                ::close(crash_fd_);
+                crash_fd_ = -1;
+            }
+        }
+
+        void open_crash_fd() noexcept {
+            close_crash_fd();
+            if (crash_flush_prepared_ && file_stream_.is_open()) {
+                crash_fd_ = ::open(file_path_.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+            }
+        }
+
+        void reset_archiver() {
+            archiver_.reset();
+            if (const auto policy = config_.archive_policy(); policy.enabled()) {
+                archiver_ = std::make_unique<LogArchiver>(policy, config_.file(), config_.time_format_in_file_name());
+            }
+        }
 
         void init() {
             std::filesystem::path full_path = config_.file();
@@ -117,6 +226,7 @@ namespace demiplane::scroll {
             // Configure ofstream buffer for better batching of syscalls
             file_stream_.rdbuf()->pubsetbuf(stream_buffer_, sizeof(stream_buffer_));
             file_path_ = full_path;
+            open_crash_fd();
         }
 
         bool should_rotate() {
@@ -140,7 +250,13 @@ namespace demiplane::scroll {
             std::lock_guard lock{mutex_};
             file_stream_.flush();
             file_stream_.close();
+
+            std::filesystem::path closed = file_path_;
             init();
+            // Same-second rotation reopens the same name in append mode — nothing was closed for good
+            if (archiver_ && closed != file_path_) {
+                archiver_->submit(std::move(closed), file_path_);
+            }
         }
     };
 }  // namespace demiplane::scroll
@@ -9,6 +9,8 @@
 #include <prefix_filter.hpp>
 #include <sink_interface.hpp>
 
+#include "log_archiver.hpp"
+
 namespace demiplane::scroll {
 
     class FileSinkConfig final : public serialization::ConfigInterface<FileSinkConfig, Json::Value> {
@@ -45,6 +47,9 @@ namespace demiplane::scroll {
             if (rotate_file_ && !add_time_to_filename_) {
                 throw std::invalid_argument("rotation is enabled, but the dynamic filename is disabled");
             }
+            if (compression_ == RotationCompression::Zstd && (compression_level_ < 1 || compression_level_ > 19)) {
+                throw std::invalid_argument("compression_level must be in [1, 19]");
+            }
         }
 
         [[nodiscard]] constexpr LogLevel threshold() const noexcept {
@@ -71,6 +76,24 @@ namespace demiplane::scroll {
         [[nodiscard]] const PrefixFilter& prefix_filter() const noexcept {
             return prefix_filter_;
         }
+        /// Applied to rotated files on a background worker; the active file is never touched
+        [[nodiscard]] constexpr RotationCompression compression() const noexcept {
+            return compression_;
+        }
+        [[nodiscard]] constexpr std::int32_t compression_level() const noexcept {
+            return compression_level_;
+        }
+        /// Oldest rotated files beyond this count are deleted (0 = unlimited)
+        [[nodiscard]] constexpr std::size_t max_retained_files() const noexcept {
+            return max_retained_files_;
+        }
+        /// Oldest rotated files are deleted until their total size fits (0 = unlimited)
+        [[nodiscard]] constexpr std::uint64_t max_retained_bytes() const noexcept {
+            return max_retained_bytes_;
+        }
+        [[nodiscard]] constexpr ArchivePolicy archive_policy() const noexcept {
+            return ArchivePolicy{compression_, compression_level_, max_retained_files_, max_retained_bytes_};
+        }
 
         static constexpr auto fields() {
             return std::tuple{
@@ -81,6 +104,10 @@ namespace demiplane::scroll {
                 serialization::Field<&FileSinkConfig::rotate_file_, "rotate_file">{},
                 serialization::Field<&FileSinkConfig::max_file_size_, "max_file_size">{},
                 serialization::Field<&FileSinkConfig::flush_each_entry_, "flush_each_entry">{},
+                serialization::Field<&FileSinkConfig::compression_, "compression">{},
+                serialization::Field<&FileSinkConfig::compression_level_, "compression_level">{},
+                serialization::Field<&FileSinkConfig::max_retained_files_, "max_retained_files">{},
+                serialization::Field<&FileSinkConfig::max_retained_bytes_, "max_retained_bytes">{},
                 serialization::
                     Field<&FileSinkConfig::prefix_filter_, "prefix_filter", serialization::FieldPolicy::Excluded>{},
             };
@@ -101,6 +128,11 @@ namespace demiplane::scroll {
         std::uint64_t max_file_size_ = gears::literals::operator""_mb(100);
         bool flush_each_entry_       = false;
         PrefixFilter prefix_filter_{};
+
+        RotationCompression compression_  = RotationCompression::None;
+        std::int32_t compression_level_   = 3;
+        std::size_t max_retained_files_   = 0;
+        std::uint64_t max_retained_bytes_ = 0;
     };
 
     class FileSinkConfig::Builder {
@@ -161,6 +193,30 @@ namespace demiplane::scroll {
             return std::forward<Self>(self);
         }
 
+        template <typename Self>
+        constexpr auto&& compression(this Self&& self, const RotationCompression value) noexcept {
+            self.config_.compression_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& compression_level(this Self&& self, const std::int32_t value) noexcept {
+            self.config_.compression_level_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& max_retained_files(this Self&& self, const std::size_t value) noexcept {
+            self.config_.max_retained_files_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& max_retained_bytes(this Self&& self, const std::uint64_t value) noexcept {
+            self.config_.max_retained_bytes_ = value;
+            return std::forward<Self>(self);
+        }
+
         [[nodiscard]] FileSinkConfig finalize() && {
             config_.validate();
             return std::move(config_);
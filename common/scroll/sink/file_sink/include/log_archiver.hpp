@@ -0,0 +1,106 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace demiplane::scroll {
+
+    enum class RotationCompression : std::uint8_t {
+        None,  // keep rotated files as-is
+        Zstd   // compress to <file>.zst and remove the original
+    };
+
+    /**
+     * @brief What happens to a file once FileSink rotates away from it
+     *
+     * Limits apply to rotated (closed) files only — the active file is never touched.
+     * 0 means unlimited.
+     */
+    struct ArchivePolicy {
+        RotationCompression compression  = RotationCompression::None;
+        std::int32_t compression_level   = 3;
+        std::size_t max_retained_files   = 0;
+        std::uint64_t max_retained_bytes = 0;
+
+        [[nodiscard]] constexpr bool enabled() const noexcept {
+            return compression != RotationCompression::None || max_retained_files != 0 || max_retained_bytes != 0;
+        }
+
+        constexpr bool operator==(const ArchivePolicy&) const noexcept = default;
+    };
+
+    /**
+     * @brief Low-priority background stage for rotated log files
+     *
+     * FileSink hands every closed file to submit() (a queue push, never blocks
+     * on I/O) and keeps writing. A dedicated worker thread, running at the
+     * lowest CPU (and, on Linux, idle I/O) priority:
+     * 1. Compresses the file (zstd, streamed in chunks) to "<file>.zst"
+     * 2. Deletes the oldest rotated files of the same family ("<stem>_<time><ext>[.zst]")
+     *    until both max_retained_files and max_retained_bytes hold; names whose <time>
+     *    does not parse with the sink's time format belong to someone else and are kept
+     *
+     * Failures are best-effort: a file that cannot be compressed stays uncompressed.
+     * Pending work is drained before the destructor returns.
+     */
+    class LogArchiver {
+    public:
+        /**
+         * @param policy Compression / retention settings
+         * @param family_base Configured sink path (e.g. "logs/app.log"); rotated files
+         *                    are "logs/app_<time>.log"
+         * @param time_format strftime format of <time> (the sink's time_format_in_file_name)
+         */
+        LogArchiver(ArchivePolicy policy, std::filesystem::path family_base, std::string time_format);
+        ~LogArchiver();
+
+        LogArchiver(const LogArchiver&)            = delete;
+        LogArchiver& operator=(const LogArchiver&) = delete;
+
+        /**
+         * @brief Queue a closed file for compression and retention enforcement
+         * @param closed File the sink just rotated away from
+         * @param active File the sink is writing now (excluded from retention)
+         */
+        void submit(std::filesystem::path closed, std::filesystem::path active);
+
+        /**
+         * @brief Block until every submitted file has been processed
+         */
+        void wait_idle();
+
+        [[nodiscard]] const ArchivePolicy& policy() const noexcept {
+            return policy_;
+        }
+
+    private:
+        struct Job {
+            std::filesystem::path closed;
+            std::filesystem::path active;
+        };
+
+        ArchivePolicy policy_;
+        std::filesystem::path family_base_;
+        std::string time_format_;
+
+        std::mutex mutex_;
+        std::condition_variable_any cv_;
+        std::condition_variable idle_cv_;
+        std::deque<Job> jobs_;
+        bool busy_ = false;
+        std::jthread worker_;
+
+        void worker_loop(const std::stop_token& token);
+        void process(const Job& job) const;
+
+        /// @return path of the compressed file, or @p path itself on failure
+        [[nodiscard]] std::filesystem::path compress(const std::filesystem::path& path) const;
+        void enforce_retention(const std::filesystem::path& active) const;
+    };
+
+}  // namespace demiplane::scroll
@@ -0,0 +1,245 @@
+#include "log_archiver.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <zstd.h>
+
+#if defined(__linux__)
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace demiplane::scroll {
+    namespace {
+        void lower_thread_priority() noexcept {
+#if defined(__linux__)
+            // nice is a per-thread attribute on Linux, so this leaves the rest of the process alone
+            const auto tid = static_cast<id_t>(::syscall(SYS_gettid));
+            std::ignore    = ::setpriority(PRIO_PROCESS, tid, 19);
+
+            // IOPRIO_CLASS_IDLE: the worker only gets disk time nobody else wants
+            constexpr int ioprio_who_process = 1;
+            constexpr int ioprio_class_idle  = 3;
+            constexpr int ioprio_class_shift = 13;
+            std::ignore =
+                ::syscall(SYS_ioprio_set, ioprio_who_process, 0, ioprio_class_idle << ioprio_class_shift);
+#endif
+        }
+
+        /// True if all of @p text is one timestamp written with @p format
+        bool is_timestamp(const std::string_view text, const std::string& format) {
+            std::istringstream in{std::string{text}};
+            std::tm tm{};
+            in >> std::get_time(&tm, format.c_str());
+            return !in.fail() && in.peek() == std::char_traits<char>::eof();
+        }
+
+        struct CCtxDeleter {
+            void operator()(ZSTD_CCtx* ctx) const noexcept {
+                ZSTD_freeCCtx(ctx);
+            }
+        };
+    }  // namespace
+
+    LogArchiver::LogArchiver(const ArchivePolicy policy, std::filesystem::path family_base, std::string time_format)
+        : policy_{policy},
+          family_base_{std::move(family_base)},
+          time_format_{std::move(time_format)},
+          worker_{[this](const std::stop_token& token) { worker_loop(token); }} {
+    }
+
+    LogArchiver::~LogArchiver() {
+        worker_.request_stop();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    void LogArchiver::submit(std::filesystem::path closed, std::filesystem::path active) {
+        {
+            std::lock_guard lock{mutex_};
+            jobs_.push_back(Job{std::move(closed), std::move(active)});
+        }
+        cv_.notify_one();
+    }
+
+    void LogArchiver::wait_idle() {
+        std::unique_lock lock{mutex_};
+        idle_cv_.wait(lock, [this] { return jobs_.empty() && !busy_; });
+    }
+
+    void LogArchiver::worker_loop(const std::stop_token& token) {
+        lower_thread_priority();
+
+        while (true) {
+            Job job;
+            {
+                std::unique_lock lock{mutex_};
+                // Stop only interrupts the wait — queued files are still drained
+                cv_.wait(lock, token, [this] { return !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+                busy_ = true;
+            }
+
+            process(job);
+
+            {
+                std::lock_guard lock{mutex_};
+                busy_ = false;
+            }
+            idle_cv_.notify_all();
+        }
+    }
+
+    void LogArchiver::process(const Job& job) const {
+        if (policy_.compression == RotationCompression::Zstd) {
+            std::ignore = compress(job.closed);
+        }
+        enforce_retention(job.active);
+    }
+
+    std::filesystem::path LogArchiver::compress(const std::filesystem::path& path) const {
+        std::filesystem::path target = path;
+        target += ".zst";
+        std::filesystem::path tmp = target;
+        tmp += ".tmp";
+
+        std::error_code ec;
+        {
+            std::ifstream in{path, std::ios::binary};
+            std::ofstream out{tmp, std::ios::binary | std::ios::trunc};
+            const std::unique_ptr<ZSTD_CCtx, CCtxDeleter> cctx{ZSTD_createCCtx()};
+            if (!in || !out || !cctx) {
+                std::filesystem::remove(tmp, ec);
+                return path;
+            }
+            ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, policy_.compression_level);
+            ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_checksumFlag, 1);
+
+            std::vector<char> in_buf(ZSTD_CStreamInSize());
+            std::vector<char> out_buf(ZSTD_CStreamOutSize());
+
+            bool last = false;
+            while (!last) {
+                in.read(in_buf.data(), static_cast<std::streamsize>(in_buf.size()));
+                const auto read = static_cast<std::size_t>(in.gcount());
+                last            = in.eof();
+
+                const ZSTD_EndDirective mode = last ? ZSTD_e_end : ZSTD_e_continue;
+                ZSTD_inBuffer input{in_buf.data(), read, 0};
+                bool finished = false;
+                while (!finished) {
+                    ZSTD_outBuffer output{out_buf.data(), out_buf.size(), 0};
+                    const std::size_t remaining = ZSTD_compressStream2(cctx.get(), &output, &input, mode);
+                    if (ZSTD_isError(remaining)) {
+                        out.close();
+                        std::filesystem::remove(tmp, ec);
+                        return path;
+                    }
+                    out.write(out_buf.data(), static_cast<std::streamsize>(output.pos));
+                    finished = last ? remaining == 0 : input.pos == input.size;
+                }
+            }
+
+            out.flush();
+            if (!out) {
+                out.close();
+                std::filesystem::remove(tmp, ec);
+                return path;
+            }
+        }
+
+        std::filesystem::rename(tmp, target, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            return path;
+        }
+        // Keep the original mtime so retention still orders the family by when it was written
+        if (const auto mtime = std::filesystem::last_write_time(path, ec); !ec) {
+            std::filesystem::last_write_time(target, mtime, ec);
+        }
+        std::filesystem::remove(path, ec);
+        return target;
+    }
+
+    void LogArchiver::enforce_retention(const std::filesystem::path& active) const {
+        if (policy_.max_retained_files == 0 && policy_.max_retained_bytes == 0) {
+            return;
+        }
+
+        const std::filesystem::path dir =
+            family_base_.parent_path().empty() ? std::filesystem::path{"."} : family_base_.parent_path();
+        const std::string prefix      = family_base_.stem().string() + "_";
+        const std::string ext         = family_base_.extension().string();
+        const std::string zstd_ext    = ext + ".zst";
+        const std::string active_name = active.filename().string();
+
+        struct Candidate {
+            std::filesystem::path path;
+            std::filesystem::file_time_type mtime;
+            std::uintmax_t size;
+        };
+        std::vector<Candidate> rotated;
+
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator{dir, ec}) {
+            if (!entry.is_regular_file(ec)) {
+                continue;
+            }
+            const std::string name = entry.path().filename().string();
+            if (name == active_name || !name.starts_with(prefix)) {
+                continue;
+            }
+            // Only "<stem>_<time><ext>[.zst]": a sibling sink such as app_audit.log shares the prefix
+            std::string_view stamp{name};
+            stamp.remove_prefix(prefix.size());
+            if (stamp.ends_with(zstd_ext)) {
+                stamp.remove_suffix(zstd_ext.size());
+            } else if (stamp.ends_with(ext)) {
+                stamp.remove_suffix(ext.size());
+            } else {
+                continue;
+            }
+            if (!is_timestamp(stamp, time_format_)) {
+                continue;
+            }
+            rotated.push_back(Candidate{entry.path(), entry.last_write_time(ec), entry.file_size(ec)});
+        }
+
+        // Oldest first; rotated names embed their timestamp, so the name breaks mtime ties
+        std::ranges::sort(rotated, [](const Candidate& lhs, const Candidate& rhs) {
+            return std::tie(lhs.mtime, lhs.path) < std::tie(rhs.mtime, rhs.path);
+        });
+
+        std::size_t count    = rotated.size();
+        std::uintmax_t total = 0;
+        for (const auto& candidate : rotated) {
+            total += candidate.size;
+        }
+
+        for (const auto& candidate : rotated) {
+            const bool over_files = policy_.max_retained_files != 0 && count > policy_.max_retained_files;
+            const bool over_bytes = policy_.max_retained_bytes != 0 && total > policy_.max_retained_bytes;
+            if (!over_files && !over_bytes) {
+                break;
+            }
+            if (std::filesystem::remove(candidate.path, ec)) {
+                --count;
+                total -= candidate.size;
+            }
+        }
+    }
+}  // namespace demiplane::scroll
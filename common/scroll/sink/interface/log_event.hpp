@@ -4,6 +4,8 @@
 
 #include <entry_interface.hpp>
 
+#include "log_fields.hpp"
+
 namespace demiplane::scroll {
     /**
      * @brief Raw log event data container
@@ -18,6 +20,7 @@ namespace demiplane::scroll {
         LogLevel level = LogLevel::Debug;
         PrefixNameStorage prefix{};  // owning class-name/prefix; empty if none
         std::string message;         // Already formatted with std::format or stream
+        LogFields fields;            // Structured key/values (StreamProxy::field / SCROLL_FIELDS)
 
         // Metadata (captured in producer thread - correct TID/PID)
         detail::MetaSource location;
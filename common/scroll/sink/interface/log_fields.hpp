@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace demiplane::scroll {
+    /**
+     * @brief Key/value reference produced by field() / SCROLL_FIELDS for StreamProxy::operator<<
+     *
+     * Holds a reference — consumed within the same full expression.
+     */
+    template <typename T>
+    struct FieldRef {
+        std::string_view key;
+        const T& value;
+    };
+
+    template <typename T>
+    [[nodiscard]] constexpr FieldRef<T> field(const std::string_view key, const T& value) noexcept {
+        return FieldRef<T>{key, value};
+    }
+
+    /**
+     * @brief Typed structured fields attached to a LogEvent
+     *
+     * Small vector: the first inline_capacity fields live in the object itself,
+     * further ones spill to the heap. Keys and string values are packed back to
+     * back into one owned buffer, so a LogFields is self-contained (safe to hand
+     * to the consumer thread) and clear() keeps every buffer's capacity for the
+     * next event that reuses the ring slot.
+     *
+     * Values keep their type — bool, signed / unsigned integers, floating point,
+     * text — so structured sinks can write numbers as numbers. Anything else is
+     * rendered once with operator<< and stored as text.
+     */
+    class LogFields {
+    public:
+        using Value = std::variant<bool, std::int64_t, std::uint64_t, double, std::string_view>;
+
+        struct Field {
+            std::string_view key;
+            Value value;
+        };
+
+        static constexpr std::size_t inline_capacity = 8;
+
+        template <typename T>
+        void add(const std::string_view key, const T& value) {
+            using U = std::remove_cvref_t<T>;
+            if constexpr (std::same_as<U, bool>) {
+                push(key, Stored{value});
+            } else if constexpr (std::same_as<U, char>) {
+                push(key, Stored{store(std::string_view{&value, 1})});
+            } else if constexpr (std::signed_integral<U>) {
+                push(key, Stored{static_cast<std::int64_t>(value)});
+            } else if constexpr (std::unsigned_integral<U>) {
+                push(key, Stored{static_cast<std::uint64_t>(value)});
+            } else if constexpr (std::floating_point<U>) {
+                push(key, Stored{static_cast<double>(value)});
+            } else if constexpr (std::convertible_to<const U&, std::string_view>) {
+                push(key, Stored{store(std::string_view{value})});
+            } else {
+                std::ostringstream rendered;
+                rendered << value;
+                push(key, Stored{store(rendered.view())});
+            }
+        }
+
+        void clear() noexcept {
+            size_ = 0;
+            text_.clear();
+            overflow_.clear();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+        /// Field @p index in insertion order; views stay valid until the next add() / clear()
+        [[nodiscard]] Field operator[](const std::size_t index) const noexcept {
+            const Slot& slot = index < inline_capacity ? inline_[index] : overflow_[index - inline_capacity];
+            return Field{view(slot.key),
+                         std::visit(
+                             [this]<typename S>(const S& stored) -> Value {
+                                 if constexpr (std::same_as<S, TextRef>) {
+                                     return view(stored);
+                                 } else {
+                                     return stored;
+                                 }
+                             },
+                             slot.value)};
+        }
+
+    private:
+        struct TextRef {
+            std::uint32_t offset = 0;
+            std::uint32_t length = 0;
+        };
+        using Stored = std::variant<bool, std::int64_t, std::uint64_t, double, TextRef>;
+
+        struct Slot {
+            TextRef key;
+            Stored value;
+        };
+
+        std::array<Slot, inline_capacity> inline_{};
+        std::vector<Slot> overflow_;
+        std::size_t size_ = 0;
+        std::string text_;
+
+        TextRef store(const std::string_view text) {
+            const TextRef ref{static_cast<std::uint32_t>(text_.size()), static_cast<std::uint32_t>(text.size())};
+            text_.append(text);
+            return ref;
+        }
+
+        [[nodiscard]] std::string_view view(const TextRef ref) const noexcept {
+            return std::string_view{text_}.substr(ref.offset, ref.length);
+        }
+
+        void push(const std::string_view key, const Stored value) {
+            const Slot slot{store(key), value};
+            if (size_ < inline_capacity) {
+                inline_[size_] = slot;
+            } else {
+                overflow_.push_back(slot);
+            }
+            ++size_;
+        }
+    };
+}  // namespace demiplane::scroll
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -31,13 +32,17 @@ namespace demiplane::scroll {
 
         /**
          * @brief Process a batch of log events
-         * @param batch Shared ownership of the event batch
+         * @param batch Events in publish order; valid only for the duration of the call
+         *
+         * The span points straight into the logger's ring buffer. The slots are handed back
+         * to producers once every sink has returned — copy what must outlive the call.
+         * A run that wraps the end of the ring arrives as two consecutive calls.
          *
          * Default: iterates and calls process() per event.
          * Override for batch-optimized I/O (e.g., batch network sends).
          */
-        virtual void process_batch(const std::shared_ptr<std::vector<LogEvent>>& batch) {
-            for (const auto& event : *batch) {
+        virtual void process_batch(const std::span<const LogEvent> batch) {
+            for (const auto& event : batch) {
                 process(event);
             }
         }
@@ -52,6 +57,34 @@ namespace demiplane::scroll {
          */
         virtual void flush() = 0;
 
+        /**
+         * @brief Last-gasp write of buffered output from a fatal signal handler
+         *
+         * Runs inside CrashHandler: must be async-signal-safe — no locks, no allocation,
+         * raw write(2) only. Default: nothing is buffered beyond what the OS already has.
+         */
+        virtual void crash_flush() noexcept {
+        }
+
+        /**
+         * @brief Acquire what crash_flush() needs, now that a CrashHandler is installed
+         *
+         * Called by CrashHandler::install() for the sinks of live Loggers, and by add_sink()
+         * once it is installed; may run more than once. Sinks only pay for crash support
+         * when it is used. Default: nothing to acquire.
+         */
+        virtual void prepare_crash_flush() {
+        }
+
+        /**
+         * @brief Reopen the output target after it was moved away (logrotate + SIGHUP)
+         *
+         * Runs on the sink's strand via Logger::reopen(), i.e. between two batches.
+         * Default: nothing to reopen (console, in-memory sinks).
+         */
+        virtual void reopen() {
+        }
+
         /**
          * @brief Check if this sink should process this log level
          * @param lvl Log level to check
@@ -62,4 +95,26 @@ namespace demiplane::scroll {
          */
         [[nodiscard]] virtual bool should_log(LogLevel lvl, std::string_view prefix) const noexcept = 0;
     };
+
+    /**
+     * @brief Sink whose config can be replaced while it is attached to a running Logger
+     *
+     * Logger::reconfigure() looks the sink up by this interface and calls set_config()
+     * on the sink's strand, so process_batch() sees either the old config or the new
+     * one, never a mix. Calling set_config() directly is only safe while no Logger is
+     * dispatching to the sink.
+     */
+    template <typename ConfigTp>
+    class Reconfigurable {
+    public:
+        using config_type = ConfigTp;
+
+        virtual ~Reconfigurable() = default;
+
+        /**
+         * @brief Swap in @p cfg; reopens the output when its target changed
+         * @throws whatever opening the new target throws — the old config stays active
+         */
+        virtual void set_config(ConfigTp cfg) = 0;
+    };
 }  // namespace demiplane::scroll
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "mmap_file_sink_config.hpp"
+#include "mmap_segment.hpp"
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Append-only file sink writing through memory-mapped segments
+     *
+     * @tparam EntryType Defines which metadata to include (e.g., DetailedEntry, LightEntry)
+     *
+     * Alternative to FileSink for write-heavy workloads:
+     * - Each segment is preallocated to max_file_size and mmap'ed
+     * - process() formats the entry and memcpy's it at the segment tail — no syscalls
+     * - A full segment is closed (truncated to its tail) and the next one is created
+     * - On a crash, everything up to the last copied entry is already in the page cache
+     *
+     * Segment naming (index keeps names unique across rolls within the same second):
+     *   app.log → app_2025-01-18T10:30:45_0000.log, app_2025-01-18T10:30:45_0001.log, ...
+     *   (without add_time_to_filename: app_0000.log, app_0001.log, ...)
+     *
+     * Entries larger than max_file_size get a dedicated segment sized to fit.
+     * reopen() starts a new segment, like a roll.
+     */
+    template <detail::EntryConcept EntryType>
+    class MmapFileSink final : public Sink, public Reconfigurable<MmapFileSinkConfig> {
+    public:
+        template <typename MmapFileSinkConfigTp = MmapFileSinkConfig>
+            requires std::constructible_from<MmapFileSinkConfig, MmapFileSinkConfigTp>
+        explicit MmapFileSink(MmapFileSinkConfigTp&& cfg)
+            : config_{std::forward<MmapFileSinkConfigTp>(cfg)} {
+            roll(0);
+        }
+
+        ~MmapFileSink() override {
+            std::lock_guard lock{mutex_};
+            segment_.close();
+        }
+
+        void process(const LogEvent& event) override {
+            if (!should_log(event.level, event.prefix.view())) {
+                return;
+            }
+
+            auto entry = make_entry_from_event<EntryType>(event);
+            entry.format_into(format_buffer_);
+
+            std::lock_guard lock{mutex_};
+            if (!segment_.append(format_buffer_)) {
+                roll(format_buffer_.size());
+                std::ignore = segment_.append(format_buffer_);
+            }
+        }
+
+        void flush() override {
+            if (!config_.sync_on_flush()) {
+                return;
+            }
+            std::lock_guard lock{mutex_};
+            segment_.sync();
+        }
+
+        [[nodiscard]] bool should_log(LogLevel lvl, const std::string_view prefix) const noexcept override {
+            return static_cast<int8_t>(lvl) >= static_cast<int8_t>(config_.threshold()) &&
+                   config_.prefix_filter().accepts(prefix);
+        }
+
+        void reopen() override {
+            std::lock_guard lock{mutex_};
+            roll(0);
+        }
+
+        /// Swap the config; a different file or naming scheme closes the segment and starts the new series
+        void set_config(MmapFileSinkConfig cfg) override {
+            std::lock_guard lock{mutex_};
+            const bool retarget = cfg.file() != config_.file() ||
+                                  cfg.add_time_to_filename() != config_.add_time_to_filename() ||
+                                  cfg.time_format_in_file_name() != config_.time_format_in_file_name();
+
+            MmapFileSinkConfig previous = std::exchange(config_, std::move(cfg));
+            if (!retarget) {
+                return;
+            }
+            try {
+                segment_index_ = 0;
+                roll(0);
+            } catch (...) {
+                config_ = std::move(previous);
+                roll(0);
+                throw;
+            }
+        }
+
+        [[nodiscard]] constexpr const MmapFileSinkConfig& config() const noexcept {
+            return config_;
+        }
+
+        /// Path of the segment currently being written
+        [[nodiscard]] const std::filesystem::path& file_path() const noexcept {
+            return file_path_;
+        }
+
+    private:
+        MmapFileSinkConfig config_;
+        MmapSegment segment_;
+        std::filesystem::path file_path_;
+        std::mutex mutex_;
+        std::string format_buffer_;  // Reused across process() calls (no TL dependency)
+        std::uint64_t segment_index_ = 0;
+
+        /**
+         * @brief Close the current segment and map the next one
+         * @param min_capacity Room required for the pending entry
+         */
+        void roll(const std::size_t min_capacity) {
+            segment_.close();
+
+            const auto capacity = std::max<std::size_t>(config_.max_file_size(), min_capacity);
+            file_path_          = next_segment_path();
+            segment_.open(file_path_, capacity);
+        }
+
+        [[nodiscard]] std::filesystem::path next_segment_path() {
+            const std::filesystem::path& base  = config_.file();
+            const std::filesystem::path parent = base.parent_path();
+            if (!parent.empty()) {
+                std::filesystem::create_directories(parent);
+            }
+
+            std::string stem = base.stem().string();
+            if (config_.add_time_to_filename()) {
+                stem += "_" + chrono::LocalClock::current_time(config_.time_format_in_file_name());
+            }
+            const std::string ext = base.extension().string();
+
+            // Never clobber segments left by a previous run
+            std::filesystem::path candidate;
+            do {
+                candidate = parent / std::format("{}_{:04}{}", stem, segment_index_++, ext);
+            } while (std::filesystem::exists(candidate));
+            return candidate;
+        }
+    };
+}  // namespace demiplane::scroll
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <demiplane/chrono>
+#include <demiplane/gears>
+#include <filesystem>
+
+#include <config_interface.hpp>
+#include <json/json.hpp>
+#include <prefix_filter.hpp>
+#include <sink_interface.hpp>
+
+namespace demiplane::scroll {
+
+    class MmapFileSinkConfig final : public serialization::ConfigInterface<MmapFileSinkConfig, Json::Value> {
+    public:
+        // Full constructor (escape hatch)
+        constexpr MmapFileSinkConfig(const LogLevel threshold,
+                                     std::filesystem::path file,
+                                     const bool add_time_to_filename,
+                                     std::string time_format_in_file_name,
+                                     const std::uint64_t max_file_size,
+                                     const bool sync_on_flush,
+                                     PrefixFilter prefix_filter = {}) noexcept
+            : threshold_{threshold},
+              file_{std::move(file)},
+              add_time_to_filename_{add_time_to_filename},
+              time_format_in_file_name_{std::move(time_format_in_file_name)},
+              max_file_size_{max_file_size},
+              sync_on_flush_{sync_on_flush},
+              prefix_filter_{std::move(prefix_filter)} {
+        }
+
+        constexpr void validate() const override {
+            if (max_file_size_ == 0) {
+                throw std::invalid_argument("max_file_size must be greater than 0");
+            }
+            if (file_.empty()) {
+                throw std::invalid_argument("file path must be specified");
+            }
+            if (add_time_to_filename_ && time_format_in_file_name_.empty()) {
+                throw std::invalid_argument("time format must be specified");
+            }
+        }
+
+        [[nodiscard]] constexpr LogLevel threshold() const noexcept {
+            return threshold_;
+        }
+        [[nodiscard]] constexpr const std::filesystem::path& file() const noexcept {
+            return file_;
+        }
+        [[nodiscard]] constexpr bool add_time_to_filename() const noexcept {
+            return add_time_to_filename_;
+        }
+        [[nodiscard]] constexpr const std::string& time_format_in_file_name() const noexcept {
+            return time_format_in_file_name_;
+        }
+        /// Segment capacity: each segment is preallocated to this size and rolled when full
+        [[nodiscard]] constexpr std::uint64_t max_file_size() const noexcept {
+            return max_file_size_;
+        }
+        /// Issue msync(MS_ASYNC) on flush(); the page cache already survives a process crash
+        [[nodiscard]] constexpr bool sync_on_flush() const noexcept {
+            return sync_on_flush_;
+        }
+        [[nodiscard]] const PrefixFilter& prefix_filter() const noexcept {
+            return prefix_filter_;
+        }
+
+        static constexpr auto fields() {
+            return std::tuple{
+                serialization::Field<&MmapFileSinkConfig::threshold_, "threshold">{},
+                serialization::Field<&MmapFileSinkConfig::file_, "file">{},
+                serialization::Field<&MmapFileSinkConfig::add_time_to_filename_, "add_time_to_filename">{},
+                serialization::Field<&MmapFileSinkConfig::time_format_in_file_name_, "time_format_in_file_name">{},
+                serialization::Field<&MmapFileSinkConfig::max_file_size_, "max_file_size">{},
+                serialization::Field<&MmapFileSinkConfig::sync_on_flush_, "sync_on_flush">{},
+                serialization::
+                    Field<&MmapFileSinkConfig::prefix_filter_, "prefix_filter", serialization::FieldPolicy::Excluded>{},
+            };
+        }
+
+        class Builder;
+
+    private:
+        friend class ConfigInterface;
+        constexpr MmapFileSinkConfig() = default;
+
+        LogLevel threshold_ = LogLevel::Debug;
+        std::filesystem::path file_;
+        bool add_time_to_filename_            = true;
+        std::string time_format_in_file_name_ = chrono::clock_formats::iso8601;
+
+        std::uint64_t max_file_size_ = gears::literals::operator""_mb(64);
+        bool sync_on_flush_          = false;
+        PrefixFilter prefix_filter_{};
+    };
+
+    class MmapFileSinkConfig::Builder {
+    public:
+        Builder() = default;
+        explicit Builder(const MmapFileSinkConfig& existing)
+            : config_{existing} {
+        }
+        explicit Builder(MmapFileSinkConfig&& existing)
+            : config_{std::move(existing)} {
+        }
+
+        template <typename Self>
+        constexpr auto&& threshold(this Self&& self, const LogLevel value) noexcept {
+            self.config_.threshold_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& file(this Self&& self, std::filesystem::path value) noexcept {
+            self.config_.file_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& add_time_to_filename(this Self&& self, const bool value) noexcept {
+            self.config_.add_time_to_filename_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& time_format_in_file_name(this Self&& self, std::string value) noexcept {
+            self.config_.time_format_in_file_name_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& max_file_size(this Self&& self, const std::uint64_t value) noexcept {
+            self.config_.max_file_size_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& sync_on_flush(this Self&& self, const bool value) noexcept {
+            self.config_.sync_on_flush_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& prefix_filter(this Self&& self, PrefixFilter value) noexcept {
+            self.config_.prefix_filter_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        [[nodiscard]] MmapFileSinkConfig finalize() && {
+            config_.validate();
+            return std::move(config_);
+        }
+
+    private:
+        friend class MmapFileSinkConfig;
+        friend class ConfigInterface;
+        MmapFileSinkConfig config_;
+    };
+
+}  // namespace demiplane::scroll
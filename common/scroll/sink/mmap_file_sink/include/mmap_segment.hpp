@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string_view>
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Pre-allocated, memory-mapped append-only file segment
+     *
+     * Owns one file of fixed capacity. The file is reserved up-front with
+     * fallocate (ftruncate where unavailable) and mapped MAP_SHARED, so
+     * append() is a bounds check plus memcpy — no syscalls on the hot path.
+     *
+     * Data copied into the mapping lives in the page cache immediately: if the
+     * process dies, the kernel still writes it back. Only a clean close()
+     * truncates the file down to the written tail; a crashed segment keeps its
+     * zero-filled preallocated remainder.
+     *
+     * Not thread-safe — callers serialize access (sinks run on a strand).
+     */
+    class MmapSegment {
+    public:
+        MmapSegment() = default;
+        ~MmapSegment();
+
+        MmapSegment(const MmapSegment&)            = delete;
+        MmapSegment& operator=(const MmapSegment&) = delete;
+        MmapSegment(MmapSegment&& other) noexcept;
+        MmapSegment& operator=(MmapSegment&& other) noexcept;
+
+        /**
+         * @brief Create @p path, reserve @p capacity bytes and map it
+         * @throws std::system_error if the file cannot be created, allocated or mapped
+         */
+        void open(const std::filesystem::path& path, std::size_t capacity);
+
+        /**
+         * @brief Copy @p data at the tail
+         * @return false if the segment has no room left (nothing is written)
+         */
+        [[nodiscard]] bool append(std::string_view data) noexcept {
+            if (data.size() > capacity_ - tail_) {
+                return false;
+            }
+            std::memcpy(base_ + tail_, data.data(), data.size());
+            tail_ += data.size();
+            return true;
+        }
+
+        /**
+         * @brief Schedule write-back of the written range (msync MS_ASYNC)
+         */
+        void sync() const noexcept;
+
+        /**
+         * @brief Unmap, truncate the file to the written tail and close it
+         */
+        void close() noexcept;
+
+        [[nodiscard]] bool is_open() const noexcept {
+            return base_ != nullptr;
+        }
+        [[nodiscard]] std::size_t size() const noexcept {
+            return tail_;
+        }
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return capacity_;
+        }
+        [[nodiscard]] std::size_t remaining() const noexcept {
+            return capacity_ - tail_;
+        }
+
+    private:
+        int fd_               = -1;
+        char* base_           = nullptr;
+        std::size_t tail_     = 0;
+        std::size_t capacity_ = 0;
+    };
+
+}  // namespace demiplane::scroll
@@ -0,0 +1,107 @@
+#include "mmap_segment.hpp"
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace demiplane::scroll {
+    namespace {
+        [[noreturn]] void throw_errno(const std::string& what, const std::filesystem::path& path) {
+            throw std::system_error{errno, std::generic_category(), what + ": " + path.string()};
+        }
+
+        int reserve(const int fd, const std::size_t capacity) noexcept {
+#if defined(__linux__)
+            // Allocate real blocks so page faults on the mapping never hit ENOSPC (SIGBUS)
+            if (::fallocate(fd, 0, 0, static_cast<off_t>(capacity)) == 0) {
+                return 0;
+            }
+            if (errno != EOPNOTSUPP) {
+                return -1;
+            }
+#endif
+            return ::ftruncate(fd, static_cast<off_t>(capacity));
+        }
+    }  // namespace
+
+    MmapSegment::~MmapSegment() {
+        close();
+    }
+
+    MmapSegment::MmapSegment(MmapSegment&& other) noexcept
+        : fd_{std::exchange(other.fd_, -1)},
+          base_{std::exchange(other.base_, nullptr)},
+          tail_{std::exchange(other.tail_, 0)},
+          capacity_{std::exchange(other.capacity_, 0)} {
+    }
+
+    MmapSegment& MmapSegment::operator=(MmapSegment&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_       = std::exchange(other.fd_, -1);
+            base_     = std::exchange(other.base_, nullptr);
+            tail_     = std::exchange(other.tail_, 0);
+            capacity_ = std::exchange(other.capacity_, 0);
+        }
+        return *this;
+    }
+
+    void MmapSegment::open(const std::filesystem::path& path, const std::size_t capacity) {
+        close();
+
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            throw_errno("Failed to open log segment", path);
+        }
+
+        if (reserve(fd, capacity) != 0) {
+            const int saved = errno;
+            ::close(fd);
+            errno = saved;
+            throw_errno("Failed to preallocate log segment", path);
+        }
+
+        void* base = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (base == MAP_FAILED) {
+            const int saved = errno;
+            ::close(fd);
+            errno = saved;
+            throw_errno("Failed to map log segment", path);
+        }
+#if defined(__linux__)
+        ::madvise(base, capacity, MADV_SEQUENTIAL);
+#endif
+
+        fd_       = fd;
+        base_     = static_cast<char*>(base);
+        tail_     = 0;
+        capacity_ = capacity;
+    }
+
+    void MmapSegment::sync() const noexcept {
+        if (base_ != nullptr && tail_ != 0) {
+            ::msync(base_, tail_, MS_ASYNC);
+        }
+    }
+
+    void MmapSegment::close() noexcept {
+        if (base_ != nullptr) {
+            ::munmap(base_, capacity_);
+            base_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            // Drop the unused preallocated tail so readers don't see trailing NULs
+            std::ignore = ::ftruncate(fd_, static_cast<off_t>(tail_));
+            ::close(fd_);
+            fd_ = -1;
+        }
+        tail_     = 0;
+        capacity_ = 0;
+    }
+}  // namespace demiplane::scroll
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Connected, non-blocking datagram socket (Unix datagram or UDP)
+     *
+     * send() hands a whole batch to the kernel with one sendmmsg(2) on Linux
+     * (a send(2) loop elsewhere). Nothing here ever blocks: a full socket buffer
+     * or a missing peer comes back as a short count plus an error code, and the
+     * caller decides what to drop and when to reconnect.
+     *
+     * Not thread-safe — callers serialize access (sinks run on a strand).
+     */
+    class DatagramSocket {
+    public:
+        enum class Family {
+            Unix,  // address is a filesystem path (AF_UNIX, SOCK_DGRAM)
+            Udp    // address is a numeric IPv4 / IPv6 host (AF_INET / AF_INET6)
+        };
+
+        struct SendResult {
+            std::size_t sent = 0;
+            int error        = 0;  // errno of the datagram that stopped the batch; 0 if all were sent
+        };
+
+        DatagramSocket() = default;
+        ~DatagramSocket();
+
+        DatagramSocket(const DatagramSocket&)            = delete;
+        DatagramSocket& operator=(const DatagramSocket&) = delete;
+        DatagramSocket(DatagramSocket&& other) noexcept;
+        DatagramSocket& operator=(DatagramSocket&& other) noexcept;
+
+        /**
+         * @brief Create the socket and connect it to the peer
+         * @return 0 on success, errno otherwise (the socket stays closed)
+         *
+         * Connecting a datagram socket only records the peer — it never waits.
+         */
+        [[nodiscard]] int connect(Family family, const std::string& address, std::uint16_t port) noexcept;
+
+        /**
+         * @brief Send each element of @p datagrams as one datagram, in order
+         */
+        [[nodiscard]] SendResult send(std::span<const std::string_view> datagrams) noexcept;
+
+        void close() noexcept;
+
+        [[nodiscard]] bool is_open() const noexcept {
+            return fd_ >= 0;
+        }
+
+        /**
+         * @brief Errors after which the peer is gone and the socket should be reconnected
+         */
+        [[nodiscard]] static bool is_disconnect(int error) noexcept;
+
+    private:
+        int fd_ = -1;
+    };
+
+}  // namespace demiplane::scroll
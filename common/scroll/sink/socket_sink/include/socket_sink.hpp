@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <demiplane/chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gears_itoa.hpp>
+#include <unistd.h>
+
+#include "socket_sink_config.hpp"
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Ships events as datagrams to a local agent over a Unix datagram or UDP socket
+     *
+     * @tparam EntryType Line layout for Framing::Raw (e.g., DetailedEntry, LightEntry)
+     *
+     * - One datagram per event, optionally framed as RFC 5424 syslog
+     * - A batch is formatted into one reused buffer and handed to the kernel with
+     *   sendmmsg — one syscall per 64 events, never one per event
+     * - The socket is non-blocking: when the peer's buffer is full or the peer is
+     *   gone, the rest of the batch is dropped and counted instead of stalling the strand
+     * - A vanished peer is reconnected on the next batch, then at most once per
+     *   reconnect_interval_ms — connecting a datagram socket never waits
+     */
+    template <detail::EntryConcept EntryType>
+    class SocketSink final : public Sink, public Reconfigurable<SocketSinkConfig> {
+    public:
+        template <typename SocketSinkConfigTp = SocketSinkConfig>
+            requires std::constructible_from<SocketSinkConfig, SocketSinkConfigTp>
+        explicit SocketSink(SocketSinkConfigTp&& cfg)
+            : config_{std::forward<SocketSinkConfigTp>(cfg)},
+              hostname_{config_.hostname().empty() ? local_hostname() : config_.hostname()} {
+            std::ignore = reconnect();  // the agent may not be up yet — process_batch() retries
+        }
+
+        void process(const LogEvent& event) override {
+            process_batch(std::span{&event, 1});
+        }
+
+        void process_batch(const std::span<const LogEvent> batch) override {
+            std::lock_guard lock{mutex_};
+            buffer_.clear();
+            ends_.clear();
+            for (const auto& event : batch) {
+                if (!should_log(event.level, event.prefix.view())) {
+                    continue;
+                }
+                const std::size_t begin = buffer_.size();
+                format(event);
+                if (buffer_.size() - begin > config_.max_datagram_size()) {
+                    buffer_.resize(begin + config_.max_datagram_size());
+                }
+                ends_.push_back(buffer_.size());
+            }
+            if (ends_.empty()) {
+                return;
+            }
+
+            // Views are taken only now — buffer_ may have reallocated while growing
+            datagrams_.clear();
+            std::size_t begin = 0;
+            for (const std::size_t end : ends_) {
+                datagrams_.emplace_back(buffer_.data() + begin, end - begin);
+                begin = end;
+            }
+            send_pending();
+        }
+
+        void flush() override {
+            // Every batch leaves in process_batch(); nothing is held back
+        }
+
+        [[nodiscard]] bool should_log(LogLevel lvl, const std::string_view prefix) const noexcept override {
+            return static_cast<int8_t>(lvl) >= static_cast<int8_t>(config_.threshold()) &&
+                   config_.prefix_filter().accepts(prefix);
+        }
+
+        /// Drop the connection; the next batch connects again (e.g. the agent's socket path was recreated)
+        void reopen() override {
+            std::lock_guard lock{mutex_};
+            socket_.close();
+            next_connect_ = {};
+        }
+
+        /// Swap the config; the next batch connects to the (possibly new) peer
+        void set_config(SocketSinkConfig cfg) override {
+            std::lock_guard lock{mutex_};
+            config_   = std::move(cfg);
+            hostname_ = config_.hostname().empty() ? local_hostname() : config_.hostname();
+            socket_.close();
+            next_connect_ = {};
+        }
+
+        [[nodiscard]] constexpr const SocketSinkConfig& config() const noexcept {
+            return config_;
+        }
+
+        /// Datagrams accepted by the kernel
+        [[nodiscard]] std::uint64_t sent() const noexcept {
+            return sent_.load(std::memory_order_relaxed);
+        }
+
+        /// Events lost to a full socket buffer, a missing peer or an oversize datagram
+        [[nodiscard]] std::uint64_t dropped() const noexcept {
+            return dropped_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        SocketSinkConfig config_;
+        std::string hostname_;
+        DatagramSocket socket_;
+        std::chrono::steady_clock::time_point next_connect_{};
+
+        mutable std::mutex mutex_;
+        std::string buffer_;  // every datagram of the batch, back to back
+        std::string line_;    // scratch for EntryType::format_into
+        std::vector<std::size_t> ends_;
+        std::vector<std::string_view> datagrams_;
+
+        std::atomic<std::uint64_t> sent_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+
+        void send_pending() {
+            std::span<const std::string_view> pending{datagrams_};
+            bool reconnected = false;
+            while (!pending.empty()) {
+                if (!socket_.is_open()) {
+                    if (reconnected || !reconnect()) {
+                        break;
+                    }
+                    reconnected = true;
+                }
+
+                const auto [sent, error] = socket_.send(pending);
+                sent_.fetch_add(sent, std::memory_order_relaxed);
+                pending = pending.subspan(sent);
+
+                if (error == EMSGSIZE) {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    pending = pending.subspan(1);
+                } else if (DatagramSocket::is_disconnect(error)) {
+                    // The agent restarted or went away — one immediate reconnect per batch
+                    socket_.close();
+                    next_connect_ = {};
+                } else if (error != 0) {
+                    break;  // EAGAIN / ENOBUFS: the peer is not keeping up — drop, never block
+                }
+            }
+            dropped_.fetch_add(pending.size(), std::memory_order_relaxed);
+        }
+
+        bool reconnect() noexcept {
+            const auto now = std::chrono::steady_clock::now();
+            if (now < next_connect_) {
+                return false;
+            }
+            next_connect_ = now + std::chrono::milliseconds{config_.reconnect_interval_ms()};
+            return socket_.connect(config_.transport(), config_.address(), config_.port()) == 0;
+        }
+
+        void format(const LogEvent& event) {
+            if (config_.framing() == SocketSinkConfig::Framing::Rfc5424) {
+                format_rfc5424(event);
+                return;
+            }
+            auto entry = make_entry_from_event<EntryType>(event);
+            entry.format_into(line_);
+            if (!line_.empty() && line_.back() == '\n') {
+                line_.pop_back();
+            }
+            buffer_.append(line_);
+        }
+
+        /// <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA MSG
+        void format_rfc5424(const LogEvent& event) {
+            buffer_.push_back('<');
+            gears::append_decimal(buffer_, config_.facility() * 8u + syslog_severity(event.level));
+            buffer_.append(">1 ");
+            chrono::UTCClock::append_iso_ms(event.time_point.time_point, buffer_);
+            buffer_.push_back(' ');
+            append_header_field(hostname_);
+            append_header_field(config_.app_name());
+            append_header_field(event.pid.pid_str);
+            append_header_field(event.prefix.view());
+            buffer_.append("- ");
+            buffer_.append(event.message);
+        }
+
+        void append_header_field(const std::string_view value) {
+            buffer_.append(value.empty() ? std::string_view{"-"} : value);
+            buffer_.push_back(' ');
+        }
+
+        [[nodiscard]] static constexpr unsigned syslog_severity(const LogLevel lvl) noexcept {
+            switch (lvl) {
+                case LogLevel::Trace:
+                case LogLevel::Debug:
+                    return 7;  // debug
+                case LogLevel::Info:
+                    return 6;  // informational
+                case LogLevel::Warning:
+                    return 4;  // warning
+                case LogLevel::Error:
+                    return 3;  // error
+                case LogLevel::Fatal:
+                    return 2;  // critical
+                default:
+                    return 5;  // notice
+            }
+        }
+
+        [[nodiscard]] static std::string local_hostname() {
+            char name[256]{};
+            if (::gethostname(name, sizeof(name) - 1) != 0) {
+                return {};
+            }
+            return name;
+        }
+    };
+}  // namespace demiplane::scroll
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <config_interface.hpp>
+#include <json/json.hpp>
+#include <prefix_filter.hpp>
+#include <sink_interface.hpp>
+
+#include "datagram_socket.hpp"
+
+namespace demiplane::scroll {
+
+    class SocketSinkConfig final : public serialization::ConfigInterface<SocketSinkConfig, Json::Value> {
+    public:
+        using Transport = DatagramSocket::Family;
+
+        enum class Framing {
+            Raw,     // the entry's formatted line, one per datagram
+            Rfc5424  // <PRI>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID - MSG
+        };
+
+        // Full constructor (escape hatch)
+        constexpr SocketSinkConfig(const LogLevel threshold,
+                                   const Transport transport,
+                                   std::string address,
+                                   const std::uint16_t port,
+                                   const Framing framing,
+                                   PrefixFilter prefix_filter = {}) noexcept
+            : threshold_{threshold},
+              transport_{transport},
+              address_{std::move(address)},
+              port_{port},
+              framing_{framing},
+              prefix_filter_{std::move(prefix_filter)} {
+        }
+
+        constexpr void validate() const override {
+            if (address_.empty()) {
+                throw std::invalid_argument("socket address must be specified");
+            }
+            if (transport_ == Transport::Udp && port_ == 0) {
+                throw std::invalid_argument("UDP port must be specified");
+            }
+            if (facility_ > 23) {
+                throw std::invalid_argument("syslog facility must be in [0, 23]");
+            }
+            if (max_datagram_size_ == 0) {
+                throw std::invalid_argument("max_datagram_size must be greater than 0");
+            }
+        }
+
+        [[nodiscard]] constexpr LogLevel threshold() const noexcept {
+            return threshold_;
+        }
+        [[nodiscard]] constexpr Transport transport() const noexcept {
+            return transport_;
+        }
+        /// Socket path for Unix, numeric IPv4 / IPv6 host for UDP (no name lookup — it could block)
+        [[nodiscard]] const std::string& address() const noexcept {
+            return address_;
+        }
+        [[nodiscard]] constexpr std::uint16_t port() const noexcept {
+            return port_;
+        }
+        [[nodiscard]] constexpr Framing framing() const noexcept {
+            return framing_;
+        }
+        /// RFC 5424 facility code (1 = user-level, 16..23 = local0..local7)
+        [[nodiscard]] constexpr std::uint8_t facility() const noexcept {
+            return facility_;
+        }
+        [[nodiscard]] const std::string& app_name() const noexcept {
+            return app_name_;
+        }
+        /// RFC 5424 HOSTNAME; empty means gethostname() at sink construction
+        [[nodiscard]] const std::string& hostname() const noexcept {
+            return hostname_;
+        }
+        /// Longer datagrams are truncated to this size
+        [[nodiscard]] constexpr std::uint32_t max_datagram_size() const noexcept {
+            return max_datagram_size_;
+        }
+        /// Minimum pause between reconnect attempts; events are dropped (and counted) meanwhile
+        [[nodiscard]] constexpr std::uint32_t reconnect_interval_ms() const noexcept {
+            return reconnect_interval_ms_;
+        }
+        [[nodiscard]] const PrefixFilter& prefix_filter() const noexcept {
+            return prefix_filter_;
+        }
+
+        static constexpr auto fields() {
+            return std::tuple{
+                serialization::Field<&SocketSinkConfig::threshold_, "threshold">{},
+                serialization::Field<&SocketSinkConfig::transport_, "transport">{},
+                serialization::Field<&SocketSinkConfig::address_, "address">{},
+                serialization::Field<&SocketSinkConfig::port_, "port">{},
+                serialization::Field<&SocketSinkConfig::framing_, "framing">{},
+                serialization::Field<&SocketSinkConfig::facility_, "facility">{},
+                serialization::Field<&SocketSinkConfig::app_name_, "app_name">{},
+                serialization::Field<&SocketSinkConfig::hostname_, "hostname">{},
+                serialization::Field<&SocketSinkConfig::max_datagram_size_, "max_datagram_size">{},
+                serialization::Field<&SocketSinkConfig::reconnect_interval_ms_, "reconnect_interval_ms">{},
+                serialization::
+                    Field<&SocketSinkConfig::prefix_filter_, "prefix_filter", serialization::FieldPolicy::Excluded>{},
+            };
+        }
+
+        class Builder;
+
+    private:
+        friend class ConfigInterface;
+        constexpr SocketSinkConfig() = default;
+
+        LogLevel threshold_    = LogLevel::Debug;
+        Transport transport_   = Transport::Unix;
+        std::string address_   = "/dev/log";
+        std::uint16_t port_    = 514;
+        Framing framing_       = Framing::Rfc5424;
+        std::uint8_t facility_ = 1;
+        std::string app_name_  = "demiplane";
+        std::string hostname_;
+
+        std::uint32_t max_datagram_size_     = 8192;
+        std::uint32_t reconnect_interval_ms_ = 1000;
+        PrefixFilter prefix_filter_{};
+    };
+
+    class SocketSinkConfig::Builder {
+    public:
+        Builder() = default;
+        explicit Builder(const SocketSinkConfig& existing)
+            : config_{existing} {
+        }
+        explicit Builder(SocketSinkConfig&& existing)
+            : config_{std::move(existing)} {
+        }
+
+        template <typename Self>
+        constexpr auto&& threshold(this Self&& self, const LogLevel value) noexcept {
+            self.config_.threshold_ = value;
+            return std::forward<Self>(self);
+        }
+
+        /// Unix datagram socket at @p path
+        template <typename Self>
+        constexpr auto&& unix_socket(this Self&& self, std::string path) noexcept {
+            self.config_.transport_ = Transport::Unix;
+            self.config_.address_   = std::move(path);
+            return std::forward<Self>(self);
+        }
+
+        /// UDP to numeric @p host : @p port
+        template <typename Self>
+        constexpr auto&& udp(this Self&& self, std::string host, const std::uint16_t port) noexcept {
+            self.config_.transport_ = Transport::Udp;
+            self.config_.address_   = std::move(host);
+            self.config_.port_      = port;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& framing(this Self&& self, const Framing value) noexcept {
+            self.config_.framing_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& facility(this Self&& self, const std::uint8_t value) noexcept {
+            self.config_.facility_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& app_name(this Self&& self, std::string value) noexcept {
+            self.config_.app_name_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& hostname(this Self&& self, std::string value) noexcept {
+            self.config_.hostname_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& max_datagram_size(this Self&& self, const std::uint32_t value) noexcept {
+            self.config_.max_datagram_size_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& reconnect_interval_ms(this Self&& self, const std::uint32_t value) noexcept {
+            self.config_.reconnect_interval_ms_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& prefix_filter(this Self&& self, PrefixFilter value) noexcept {
+            self.config_.prefix_filter_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        [[nodiscard]] SocketSinkConfig finalize() && {
+            config_.validate();
+            return std::move(config_);
+        }
+
+    private:
+        friend class SocketSinkConfig;
+        friend class ConfigInterface;
+        SocketSinkConfig config_;
+    };
+
+}  // namespace demiplane::scroll
@@ -0,0 +1,172 @@
+#include "datagram_socket.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace demiplane::scroll {
+    namespace {
+        /// Datagrams per sendmmsg call — bounds the iovec / mmsghdr arrays on the stack
+        constexpr std::size_t send_chunk = 64;
+
+        int open_socket(const int domain) noexcept {
+#if defined(__linux__)
+            return ::socket(domain, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+#else
+            const int fd = ::socket(domain, SOCK_DGRAM, 0);
+            if (fd >= 0) {
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+            return fd;
+#endif
+        }
+
+        int connect_fd(const int fd, const sockaddr* addr, const socklen_t length) noexcept {
+            return ::connect(fd, addr, length) == 0 ? 0 : errno;
+        }
+    }  // namespace
+
+    DatagramSocket::~DatagramSocket() {
+        close();
+    }
+
+    DatagramSocket::DatagramSocket(DatagramSocket&& other) noexcept
+        : fd_{std::exchange(other.fd_, -1)} {
+    }
+
+    DatagramSocket& DatagramSocket::operator=(DatagramSocket&& other) noexcept {
+        if (this != &other) {
+            close();
+            fd_ = std::exchange(other.fd_, -1);
+        }
+        return *this;
+    }
+
+    int DatagramSocket::connect(const Family family, const std::string& address, const std::uint16_t port) noexcept {
+        close();
+
+        int domain = AF_UNIX;
+        sockaddr_storage storage{};
+        socklen_t length = 0;
+
+        if (family == Family::Unix) {
+            auto& un = reinterpret_cast<sockaddr_un&>(storage);
+            if (address.size() >= sizeof(un.sun_path)) {
+                return ENAMETOOLONG;
+            }
+            un.sun_family = AF_UNIX;
+            std::memcpy(un.sun_path, address.c_str(), address.size() + 1);
+            length = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + address.size() + 1);
+        } else if (auto& in4 = reinterpret_cast<sockaddr_in&>(storage);
+                   ::inet_pton(AF_INET, address.c_str(), &in4.sin_addr) == 1) {
+            domain         = AF_INET;
+            in4.sin_family = AF_INET;
+            in4.sin_port   = htons(port);
+            length         = sizeof(sockaddr_in);
+        } else if (auto& in6 = reinterpret_cast<sockaddr_in6&>(storage);
+                   ::inet_pton(AF_INET6, address.c_str(), &in6.sin6_addr) == 1) {
+            domain          = AF_INET6;
+            in6.sin6_family = AF_INET6;
+            in6.sin6_port   = htons(port);
+            length          = sizeof(sockaddr_in6);
+        } else {
+            return EINVAL;  // host names are not resolved here — resolving may block
+        }
+
+        const int fd = open_socket(domain);
+        if (fd < 0) {
+            return errno;
+        }
+        if (const int error = connect_fd(fd, reinterpret_cast<const sockaddr*>(&storage), length); error != 0) {
+            ::close(fd);
+            return error;
+        }
+        fd_ = fd;
+        return 0;
+    }
+
+    DatagramSocket::SendResult DatagramSocket::send(const std::span<const std::string_view> datagrams) noexcept {
+        SendResult result;
+        if (fd_ < 0) {
+            result.error = ENOTCONN;
+            return result;
+        }
+
+#if defined(__linux__)
+        std::array<iovec, send_chunk> iov{};
+        std::array<mmsghdr, send_chunk> headers{};
+        while (result.sent < datagrams.size()) {
+            const std::size_t count = std::min(send_chunk, datagrams.size() - result.sent);
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto datagram           = datagrams[result.sent + i];
+                iov[i].iov_base               = const_cast<char*>(datagram.data());
+                iov[i].iov_len                = datagram.size();
+                headers[i].msg_hdr            = msghdr{};
+                headers[i].msg_hdr.msg_iov    = &iov[i];
+                headers[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int sent = ::sendmmsg(fd_, headers.data(), static_cast<unsigned>(count), MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result.error = errno;
+                return result;
+            }
+            result.sent += static_cast<std::size_t>(sent);
+            if (static_cast<std::size_t>(sent) < count) {
+                // The kernel stops at the first failing datagram; ask it why
+                const auto next = datagrams[result.sent];
+                if (::send(fd_, next.data(), next.size(), MSG_NOSIGNAL) >= 0) {
+                    ++result.sent;
+                } else {
+                    result.error = errno;
+                    return result;
+                }
+            }
+        }
+#else
+        for (; result.sent < datagrams.size(); ++result.sent) {
+            const auto datagram = datagrams[result.sent];
+            if (::send(fd_, datagram.data(), datagram.size(), 0) < 0) {
+                result.error = errno;
+                return result;
+            }
+        }
+#endif
+        return result;
+    }
+
+    void DatagramSocket::close() noexcept {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    bool DatagramSocket::is_disconnect(const int error) noexcept {
+        switch (error) {
+            case ECONNREFUSED:
+            case ECONNRESET:
+            case ENOTCONN:
+            case ENOENT:
+            case EPIPE:
+            case EDESTADDRREQ:
+            case EBADF:
+                return true;
+            default:
+                return false;
+        }
+    }
+}  // namespace demiplane::scroll
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include <log_event.hpp>
+
+namespace demiplane::scroll {
+    /**
+     * @brief One JSON object per line
+     *
+     *   {"ts":"2025-01-18T10:30:45.123Z","level":"INF","tid":4242,"prefix":"Db",
+     *    "src":"db.cpp:42","msg":"query done","rows":17,"cached":false}
+     *
+     * Structured fields sit next to the fixed keys; numbers and booleans stay
+     * unquoted, NaN / infinity become null. "prefix" is omitted when empty.
+     */
+    struct JsonEncoder {
+        static void encode(const LogEvent& event, std::string& out);
+    };
+
+    /**
+     * @brief logfmt: space-separated key=value pairs per line
+     *
+     *   ts=2025-01-18T10:30:45.123Z level=INF tid=4242 prefix=Db src=db.cpp:42 msg="query done" rows=17
+     *
+     * Values are quoted only when they must be — empty, or containing a space,
+     * '=', '"' or a control character.
+     */
+    struct LogfmtEncoder {
+        static void encode(const LogEvent& event, std::string& out);
+    };
+}  // namespace demiplane::scroll
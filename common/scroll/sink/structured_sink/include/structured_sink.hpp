@@ -0,0 +1,78 @@
+#pragma once
+
+#include <mutex>
+
+#include "structured_encoders.hpp"
+#include "structured_sink_config.hpp"
+
+namespace demiplane::scroll {
+
+    /**
+     * @brief Machine-readable sink: one record per line with structured fields
+     *
+     * @tparam Encoder Line format — JsonEncoder or LogfmtEncoder
+     *
+     * Unlike the text sinks, this one does not go through an EntryType: the
+     * encoder writes timestamp, level, source, message and every LogFields entry
+     * straight into one reused buffer — no Json::Value trees, no per-field
+     * strings. A batch is encoded whole and handed to the stream in a single write.
+     */
+    template <typename Encoder>
+    class StructuredSink final : public Sink, public Reconfigurable<StructuredSinkConfig> {
+    public:
+        template <typename StructuredSinkConfigTp = StructuredSinkConfig>
+            requires std::constructible_from<StructuredSinkConfig, StructuredSinkConfigTp>
+        explicit StructuredSink(StructuredSinkConfigTp&& cfg) noexcept
+            : config_{std::forward<StructuredSinkConfigTp>(cfg)} {
+        }
+
+        void process(const LogEvent& event) override {
+            process_batch(std::span{&event, 1});
+        }
+
+        void process_batch(const std::span<const LogEvent> batch) override {
+            std::lock_guard lock{mutex_};
+            buffer_.clear();
+            for (const auto& event : batch) {
+                if (should_log(event.level, event.prefix.view())) {
+                    Encoder::encode(event, buffer_);
+                }
+            }
+            if (buffer_.empty()) {
+                return;
+            }
+
+            config_.output()->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            if (config_.flush_each_batch()) {
+                config_.output()->flush();
+            }
+        }
+
+        void flush() override {
+            std::lock_guard lock{mutex_};
+            config_.output()->flush();
+        }
+
+        [[nodiscard]] bool should_log(LogLevel lvl, const std::string_view prefix) const noexcept override {
+            return static_cast<int8_t>(lvl) >= static_cast<int8_t>(config_.threshold()) &&
+                   config_.prefix_filter().accepts(prefix);
+        }
+
+        void set_config(StructuredSinkConfig cfg) override {
+            std::lock_guard lock{mutex_};
+            config_ = std::move(cfg);
+        }
+
+        [[nodiscard]] constexpr const StructuredSinkConfig& config() const noexcept {
+            return config_;
+        }
+
+    private:
+        StructuredSinkConfig config_;
+        mutable std::mutex mutex_;
+        std::string buffer_;
+    };
+
+    using JsonSink   = StructuredSink<JsonEncoder>;
+    using LogfmtSink = StructuredSink<LogfmtEncoder>;
+}  // namespace demiplane::scroll
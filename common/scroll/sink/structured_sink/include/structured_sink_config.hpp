@@ -0,0 +1,110 @@
+#pragma once
+
+#include <iostream>
+
+#include <config_interface.hpp>
+#include <json/json.hpp>
+#include <prefix_filter.hpp>
+#include <sink_interface.hpp>
+
+namespace demiplane::scroll {
+
+    class StructuredSinkConfig final : public serialization::ConfigInterface<StructuredSinkConfig, Json::Value> {
+    public:
+        // Full constructor (escape hatch)
+        constexpr StructuredSinkConfig(const LogLevel threshold,
+                                       const bool flush_each_batch,
+                                       std::ostream* const output,
+                                       PrefixFilter prefix_filter = {}) noexcept
+            : threshold_{threshold},
+              flush_each_batch_{flush_each_batch},
+              output_{output},
+              prefix_filter_{std::move(prefix_filter)} {
+        }
+
+        constexpr void validate() const override {
+            // always valid
+        }
+
+        [[nodiscard]] constexpr LogLevel threshold() const noexcept {
+            return threshold_;
+        }
+        [[nodiscard]] constexpr bool flush_each_batch() const noexcept {
+            return flush_each_batch_;
+        }
+        [[nodiscard]] constexpr std::ostream* output() const noexcept {
+            return output_;
+        }
+        [[nodiscard]] constexpr const PrefixFilter& prefix_filter() const noexcept {
+            return prefix_filter_;
+        }
+
+        static constexpr auto fields() {
+            return std::tuple{
+                serialization::Field<&StructuredSinkConfig::threshold_, "threshold">{},
+                serialization::Field<&StructuredSinkConfig::flush_each_batch_, "flush_each_batch">{},
+                serialization::Field<&StructuredSinkConfig::output_, "output", serialization::FieldPolicy::Excluded>{},
+                serialization::Field<&StructuredSinkConfig::prefix_filter_,
+                                     "prefix_filter",
+                                     serialization::FieldPolicy::Excluded>{},
+            };
+        }
+
+        class Builder;
+
+    private:
+        friend class ConfigInterface;
+        constexpr StructuredSinkConfig() = default;
+
+        LogLevel threshold_    = LogLevel::Debug;
+        bool flush_each_batch_ = false;
+        std::ostream* output_  = &std::cout;
+        PrefixFilter prefix_filter_{};
+    };
+
+    class StructuredSinkConfig::Builder {
+    public:
+        Builder() = default;
+        explicit Builder(const StructuredSinkConfig& existing)
+            : config_{existing} {
+        }
+        explicit Builder(StructuredSinkConfig&& existing)
+            : config_{std::move(existing)} {
+        }
+
+        template <typename Self>
+        constexpr auto&& threshold(this Self&& self, const LogLevel value) noexcept {
+            self.config_.threshold_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& flush_each_batch(this Self&& self, const bool value) noexcept {
+            self.config_.flush_each_batch_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& output(this Self&& self, std::ostream* value) noexcept {
+            self.config_.output_ = value;
+            return std::forward<Self>(self);
+        }
+
+        template <typename Self>
+        constexpr auto&& prefix_filter(this Self&& self, PrefixFilter value) noexcept {
+            self.config_.prefix_filter_ = std::move(value);
+            return std::forward<Self>(self);
+        }
+
+        [[nodiscard]] StructuredSinkConfig finalize() && {
+            config_.validate();
+            return std::move(config_);
+        }
+
+    private:
+        friend class StructuredSinkConfig;
+        friend class ConfigInterface;
+        StructuredSinkConfig config_;
+    };
+
+}  // namespace demiplane::scroll
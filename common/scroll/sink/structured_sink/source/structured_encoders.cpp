@@ -0,0 +1,195 @@
+#include "structured_encoders.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <demiplane/chrono>
+
+#include <gears_itoa.hpp>
+
+namespace demiplane::scroll {
+    namespace {
+        constexpr char hex_digits[] = "0123456789abcdef";
+
+        [[nodiscard]] std::string_view source_file_name(const char* path) noexcept {
+            if (const char* last_slash = std::strrchr(path, '/')) {
+                return last_slash + 1;
+            }
+            return path;
+        }
+
+        void append_double(std::string& out, const double value) {
+            char buffer[32];
+            const auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, ec == std::errc{} ? end : buffer);
+        }
+
+        void append_signed(std::string& out, const std::int64_t value) {
+            if (value < 0) {
+                out.push_back('-');
+                gears::append_decimal(out, ~static_cast<std::uint64_t>(value) + 1);
+            } else {
+                gears::append_decimal(out, static_cast<std::uint64_t>(value));
+            }
+        }
+
+        [[nodiscard]] constexpr bool needs_json_escape(const char c) noexcept {
+            return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+        }
+
+        /// Quoted JSON string; plain runs are appended in one go, only escapes go char by char
+        void append_json_string(std::string& out, const std::string_view text) {
+            out.push_back('"');
+            std::size_t run = 0;
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                const char c = text[i];
+                if (!needs_json_escape(c)) {
+                    continue;
+                }
+                out.append(text.substr(run, i - run));
+                run = i + 1;
+                switch (c) {
+                    case '"':
+                        out.append("\\\"");
+                        break;
+                    case '\\':
+                        out.append("\\\\");
+                        break;
+                    case '\n':
+                        out.append("\\n");
+                        break;
+                    case '\r':
+                        out.append("\\r");
+                        break;
+                    case '\t':
+                        out.append("\\t");
+                        break;
+                    default: {
+                        const auto code = static_cast<unsigned char>(c);
+                        const char escaped[] = {'\\', 'u', '0', '0', hex_digits[code >> 4], hex_digits[code & 0xF]};
+                        out.append(escaped, sizeof(escaped));
+                    }
+                }
+            }
+            out.append(text.substr(run));
+            out.push_back('"');
+        }
+
+        [[nodiscard]] constexpr bool needs_logfmt_quotes(const std::string_view text) noexcept {
+            if (text.empty()) {
+                return true;
+            }
+            for (const char c : text) {
+                if (c == ' ' || c == '=' || c == '"' || static_cast<unsigned char>(c) < 0x20) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void append_logfmt_string(std::string& out, const std::string_view text) {
+            if (needs_logfmt_quotes(text)) {
+                append_json_string(out, text);  // same escaping rules inside the quotes
+            } else {
+                out.append(text);
+            }
+        }
+
+        template <typename TextWriter>
+        void append_field_value(std::string& out, const LogFields::Value& value, TextWriter&& write_text) {
+            std::visit(
+                [&]<typename V>(const V& v) {
+                    if constexpr (std::same_as<V, bool>) {
+                        out.append(v ? "true" : "false");
+                    } else if constexpr (std::same_as<V, std::int64_t>) {
+                        append_signed(out, v);
+                    } else if constexpr (std::same_as<V, std::uint64_t>) {
+                        gears::append_decimal(out, v);
+                    } else if constexpr (std::same_as<V, double>) {
+                        if (std::isfinite(v)) {
+                            append_double(out, v);
+                        } else {
+                            write_text(out, v);
+                        }
+                    } else {
+                        write_text(out, v);
+                    }
+                },
+                value);
+        }
+    }  // namespace
+
+    void JsonEncoder::encode(const LogEvent& event, std::string& out) {
+        out.append(R"({"ts":")");
+        chrono::UTCClock::append_iso_ms(event.time_point.time_point, out);
+        out.append(R"(","level":")");
+        out.append(log_level_to_string(event.level));
+        out.append(R"(","tid":)");
+        gears::append_decimal(out, event.tid.tid);
+
+        if (const auto prefix = event.prefix.view(); !prefix.empty()) {
+            out.append(R"(,"prefix":)");
+            append_json_string(out, prefix);
+        }
+
+        out.append(R"(,"src":")");
+        out.append(source_file_name(event.location.location.file_name()));
+        out.push_back(':');
+        gears::append_decimal(out, event.location.location.line());
+        out.append(R"(","msg":)");
+        append_json_string(out, event.message);
+
+        const auto write_text = []<typename V>(std::string& dst, const V& v) {
+            if constexpr (std::same_as<V, double>) {
+                dst.append("null");  // JSON has no NaN / Infinity
+            } else {
+                append_json_string(dst, v);
+            }
+        };
+        for (std::size_t i = 0; i < event.fields.size(); ++i) {
+            const auto [key, value] = event.fields[i];
+            out.push_back(',');
+            append_json_string(out, key);
+            out.push_back(':');
+            append_field_value(out, value, write_text);
+        }
+        out.append("}\n");
+    }
+
+    void LogfmtEncoder::encode(const LogEvent& event, std::string& out) {
+        out.append("ts=");
+        chrono::UTCClock::append_iso_ms(event.time_point.time_point, out);
+        out.append(" level=");
+        out.append(log_level_to_string(event.level));
+        out.append(" tid=");
+        gears::append_decimal(out, event.tid.tid);
+
+        if (const auto prefix = event.prefix.view(); !prefix.empty()) {
+            out.append(" prefix=");
+            append_logfmt_string(out, prefix);
+        }
+
+        out.append(" src=");
+        out.append(source_file_name(event.location.location.file_name()));
+        out.push_back(':');
+        gears::append_decimal(out, event.location.location.line());
+        out.append(" msg=");
+        append_logfmt_string(out, event.message);
+
+        const auto write_text = []<typename V>(std::string& dst, const V& v) {
+            if constexpr (std::same_as<V, double>) {
+                dst.append(std::isnan(v) ? "NaN" : v > 0 ? "+Inf" : "-Inf");
+            } else {
+                append_logfmt_string(dst, v);
+            }
+        };
+        for (std::size_t i = 0; i < event.fields.size(); ++i) {
+            const auto [key, value] = event.fields[i];
+            out.push_back(' ');
+            out.append(key);
+            out.push_back('=');
+            append_field_value(out, value, write_text);
+        }
+        out.push_back('\n');
+    }
+}  // namespace demiplane::scroll
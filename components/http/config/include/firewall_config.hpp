@@ -5,12 +5,12 @@
 namespace demiplane::http {
     struct rate_limit {
         std::uint32_t max_in_flight = 0;  // 0 → unlimited
-        std::uint32_t req_per_sec   = 0;  // averaged, 0 → unlimited
+        std::uint32_t req_per_sec   = 0;  // per client, every request on every connection; 0 → unlimited
         std::uint32_t burst         = 0;  // extra tokens beyond steady rate
     };
 
     struct ip_rule {
         std::string cidr;   // "192.168.0.0/24" or "::1/128"
-        rate_limit limits;  // 0/0/0 means block? (TBD)
+        rate_limit limits;  // all zero blocks the range
     };
 }  // namespace demiplane::http
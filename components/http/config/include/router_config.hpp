@@ -1,4 +1,8 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <boost/unordered/unordered_flat_map.hpp>
@@ -2,14 +2,24 @@
 #include <boost/asio/awaitable.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/http.hpp>
+
+#include "arena_allocator.hpp"
 namespace demiplane::http {
     class RequestContext;
-    using Request        = boost::beast::http::request<boost::beast::http::string_body>;
+    class StreamExchange;
+
+    // Requests allocate fields and body from the connection arena (see Server::session)
+    using RequestAllocator = ArenaAllocator<char>;
+    using RequestBody      = boost::beast::http::basic_string_body<char, std::char_traits<char>, RequestAllocator>;
+    using RequestFields    = boost::beast::http::basic_fields<RequestAllocator>;
+
+    using Request        = boost::beast::http::request<RequestBody, RequestFields>;
     using Response       = boost::beast::http::response<boost::beast::http::string_body>;
     using AsyncResponse  = boost::asio::awaitable<Response>;
     using AsyncVoid      = boost::asio::awaitable<void>;
     using Handler        = std::function<AsyncResponse(Request)>;
     using ContextHandler = std::function<AsyncResponse(RequestContext)>;
+    using StreamHandler  = std::function<AsyncVoid(StreamExchange&)>;
     using Middleware =
         std::function<boost::asio::awaitable<void>(Request&, Response&, std::function<boost::asio::awaitable<void>()>)>;
 
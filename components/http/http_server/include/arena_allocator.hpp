@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+namespace demiplane::http {
+
+    /**
+     * @brief Allocator over a std::pmr::memory_resource that can be assigned and propagates on move
+     *
+     * Beast requires both from a fields allocator, and std::pmr::polymorphic_allocator offers neither.
+     * Copies of a container fall back to the default resource, so copying a request detaches it
+     * from the connection arena.
+     */
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type                             = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+
+        ArenaAllocator() noexcept = default;
+
+        explicit ArenaAllocator(std::pmr::memory_resource* resource) noexcept
+            : resource_{resource} {
+        }
+
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept  // implicit: containers rebind allocators
+            : resource_{other.resource()} {
+        }
+
+        [[nodiscard]] T* allocate(const std::size_t n) {
+            return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* ptr, const std::size_t n) noexcept {
+            resource_->deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        [[nodiscard]] ArenaAllocator select_on_container_copy_construction() const noexcept {
+            return ArenaAllocator{};
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* resource() const noexcept {
+            return resource_;
+        }
+
+        template <typename U>
+        friend bool operator==(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept {
+            return lhs.resource_ == rhs.resource() || lhs.resource_->is_equal(*rhs.resource());
+        }
+
+    private:
+        std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+    };
+
+    /**
+     * @brief Heap fallback of a connection arena that keeps count of what the arena holds on it
+     *
+     * The server bounds read-ahead on this count; it drops back to zero when the arena is rewound.
+     */
+    class CountingResource final : public std::pmr::memory_resource {
+    public:
+        [[nodiscard]] std::size_t allocated() const noexcept {
+            return allocated_;
+        }
+
+    private:
+        void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+            void* memory = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            allocated_ += bytes;
+            return memory;
+        }
+
+        void do_deallocate(void* memory, const std::size_t bytes, const std::size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+            allocated_ -= bytes;
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+        std::size_t allocated_ = 0;
+    };
+
+}  // namespace demiplane::http
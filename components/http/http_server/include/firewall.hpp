@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+
+#include "firewall_config.hpp"
+
+namespace demiplane::http {
+
+    /**
+     * @brief Accept-time enforcement of `ip_rule`s
+     *
+     * Rules are matched by longest prefix over a binary trie; IPv4 lives in the IPv4-mapped
+     * IPv6 range, so one trie serves both families. Clients that match a rule get their own
+     * state in a sharded map: an in-flight connection count and a rate bucket kept as one
+     * atomic (GCRA form of a token bucket, `burst` extra tokens on top of `req_per_sec`).
+     * The bucket is charged per request: admit() takes the connection's first, the session
+     * takes every later one through Lease::charge(), so keep-alive does not get around it.
+     * A zero field leaves that limit off, an all-zero rule blocks its range.
+     * State of clients with a full bucket and no connections is dropped by expire().
+     */
+    class Firewall {
+        struct ClientState;
+
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Connection slot of one admitted client, released on destruction
+         */
+        class Lease {
+        public:
+            Lease() = default;
+            ~Lease();
+
+            Lease(Lease&& other) noexcept;
+            Lease& operator=(Lease&& other) noexcept;
+            Lease(const Lease&)            = delete;
+            Lease& operator=(const Lease&) = delete;
+
+            /// Takes one request of the connection from the client's rate; false once it is over
+            [[nodiscard]] bool charge(Clock::time_point now = Clock::now()) noexcept;
+
+        private:
+            friend class Firewall;
+
+            explicit Lease(ClientState* state) noexcept
+                : state_{state} {
+            }
+
+            ClientState* state_ = nullptr;  // null when the client's rule has no limit to track
+            bool prepaid_       = false;    // admit() already charged the connection's first request
+        };
+
+        /// @throws std::invalid_argument on a malformed CIDR; a repeated CIDR replaces the earlier rule
+        explicit Firewall(const std::vector<ip_rule>& rules);
+        ~Firewall();
+
+        Firewall(const Firewall&)            = delete;
+        Firewall& operator=(const Firewall&) = delete;
+
+        /// Most specific rule covering @p address, nullptr if none does
+        [[nodiscard]] const rate_limit* match(const boost::asio::ip::address& address) const noexcept;
+
+        /**
+         * @brief Decides on a new connection from @p address, charging its first request
+         * @return A lease to keep for the lifetime of the connection, or nothing if it must be dropped
+         */
+        [[nodiscard]] std::optional<Lease> admit(const boost::asio::ip::address& address,
+                                                 Clock::time_point now = Clock::now());
+
+        /// Drops state that a fresh client would have anyway; run periodically
+        void expire(Clock::time_point now = Clock::now());
+
+        /// Connections refused so far
+        [[nodiscard]] std::uint64_t rejected() const noexcept {
+            return rejected_.load(std::memory_order_relaxed);
+        }
+
+        /// Clients with state held, for monitoring and tests
+        [[nodiscard]] std::size_t tracked_clients() const;
+
+    private:
+        using AddressKey = std::array<std::uint8_t, 16>;
+
+        struct Node {
+            std::array<std::int32_t, 2> children{-1, -1};
+            std::int32_t rule = -1;
+        };
+
+        struct alignas(64) Shard {
+            mutable std::mutex mutex;
+            boost::unordered_flat_map<AddressKey, std::unique_ptr<ClientState>> clients;
+        };
+
+        static constexpr std::size_t shard_count = 16;
+
+        std::vector<rate_limit> rules_;
+        std::vector<Node> nodes_;  // nodes_[0] is the root
+        std::array<Shard, shard_count> shards_;
+        std::atomic<std::uint64_t> rejected_{0};
+
+        void insert(const AddressKey& key, std::size_t prefix_length, std::size_t rule);
+        [[nodiscard]] const rate_limit* match(const AddressKey& key) const noexcept;
+        [[nodiscard]] Shard& shard_of(const AddressKey& key) noexcept;
+    };
+
+}  // namespace demiplane::http
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace demiplane::http {
+
+    using QueryParam = std::pair<std::string_view, std::string_view>;
+
+    /**
+     * @brief Parsed `application/x-www-form-urlencoded` key/value pairs
+     *
+     * Pairs without escapes view straight into the parsed text. Pairs with `%XX` or `+`
+     * are decoded into a buffer owned by this object, allocated once per parse and only
+     * when the text has escapes at all. A key without `=` gets an empty value.
+     * Storage comes from the resource given to parse(); copies use the default resource.
+     */
+    class QueryParams {
+    public:
+        QueryParams() = default;
+
+        QueryParams(const QueryParams& other);
+        QueryParams& operator=(const QueryParams& other);
+        QueryParams(QueryParams&&) noexcept = default;
+        QueryParams& operator=(QueryParams&& other);
+        ~QueryParams() = default;
+
+        /// Single pass over @p query; the result views into it unless decoding was needed
+        [[nodiscard]] static QueryParams
+        parse(std::string_view query, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        /// First value of @p name
+        [[nodiscard]] std::optional<std::string_view> get(std::string_view name) const noexcept;
+
+        [[nodiscard]] auto begin() const noexcept {
+            return items_.begin();
+        }
+        [[nodiscard]] auto end() const noexcept {
+            return items_.end();
+        }
+        [[nodiscard]] std::size_t size() const noexcept {
+            return items_.size();
+        }
+        [[nodiscard]] bool empty() const noexcept {
+            return items_.empty();
+        }
+
+    private:
+        friend class RequestContext;  // rebinds views into the target when a context is copied
+
+        std::pmr::vector<QueryParam> items_;
+        std::pmr::vector<char> decoded_;  // sized once by parse(), never grows
+
+        explicit QueryParams(std::pmr::memory_resource* resource);
+
+        /// Points views that were into @p from (the old decoded_ storage) at decoded_
+        void rebind_decoded(const char* from) noexcept;
+    };
+
+}  // namespace demiplane::http
@@ -4,8 +4,12 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "aliases.hpp"
+#include "query_params.hpp"
+#include "route_trie.hpp"
 
 #include <json/json.h>
 
@@ -13,10 +17,28 @@
 
 namespace demiplane::http {
 
+    /**
+     * @brief Per-request view used by handlers
+     *
+     * Headers are looked up lazily in the Beast fields (case-insensitively), path and query
+     * parameters are views into the request target; the query string is parsed on first access.
+     * Moving keeps those views valid because Beast moves the target and header storage by
+     * pointer; copying rebinds them to the copy.
+     *
+     * The server hands out contexts whose request lives in the per-connection arena, which
+     * is rewound after the response is written. A handler that keeps the request beyond its
+     * response must copy the context: copies allocate from the default resource.
+     */
     class RequestContext {
     public:
         explicit RequestContext(Request req);
 
+        RequestContext(const RequestContext& other);
+        RequestContext& operator=(const RequestContext& other);
+        RequestContext(RequestContext&&) noexcept            = default;
+        RequestContext& operator=(RequestContext&&) noexcept = default;
+        ~RequestContext()                                    = default;
+
         // Path parameter access with type safety
         template <typename T>
         std::optional<T> path(std::string_view name) const;
@@ -31,12 +53,15 @@ namespace demiplane::http {
         template <typename T>
         T query_or(std::string_view name, T default_value) const;
 
+        // All query parameters, percent-decoded
+        const QueryParams& query_params() const;
+
         // Header access
-        std::optional<std::string> header(std::string_view name) const;
-        std::string header_or(std::string_view name, std::string_view default_value) const;
+        std::optional<std::string_view> header(std::string_view name) const;
+        std::string_view header_or(std::string_view name, std::string_view default_value) const;
 
         // Body content access
-        std::string body() const {
+        std::string_view body() const {
             return request_.body();
         }
 
@@ -56,14 +81,16 @@ namespace demiplane::http {
         std::optional<std::vector<MultipartField>> multipart_data() const;
 
         // Request data
-        std::string method() const {
-            return std::string(request_.method_string());
+        std::string_view method() const {
+            const auto value = request_.method_string();
+            return {value.data(), value.size()};
         }
-        std::string target() const {
-            return std::string(request_.target());
+        std::string_view target() const {
+            const auto value = request_.target();
+            return {value.data(), value.size()};
         }
-        std::string path_only() const;
-        std::string query_string() const;
+        std::string_view path_only() const;
+        std::string_view query_string() const;
 
         // Content type helpers
         bool is_json() const;
@@ -74,8 +101,8 @@ namespace demiplane::http {
         std::string preferred_content_type() const;
 
         // Internal methods for framework use
-        void set_path_params(std::unordered_map<std::string, std::string> params);
-        void set_query_params(std::unordered_map<std::string, std::string> params);
+        // Values must view into target()
+        void set_path_params(const PathParams& params);
 
     private:
         Request request_;
@@ -85,31 +112,33 @@ namespace demiplane::http {
         mutable std::optional<std::unordered_map<std::string, std::string>> cached_form_data_;
         mutable std::optional<std::vector<MultipartField>> cached_multipart_data_;
 
-        // Private maps
-        std::unordered_map<std::string, std::string> path_params_;
-        std::unordered_map<std::string, std::string> query_params_;
-        std::unordered_map<std::string, std::string> headers_;
+        PathParams path_params_;
+        mutable std::optional<QueryParams> query_params_;
 
-        void parse_headers();
+        /// Points views that were into @p from (another context's target) at target()
+        void rebind_params(std::string_view from) noexcept;
         Json::Value parse_json_body() const;
         std::unordered_map<std::string, std::string> parse_form_data_body() const;
         std::vector<MultipartField> parse_multipart_body() const;
 
         template <typename T>
-        std::optional<T> convert_string(const std::string& value) const;
+        std::optional<T> convert_string(std::string_view value) const;
     };
 
     // Template specializations
     template <>
-    std::optional<int> RequestContext::convert_string<int>(const std::string& value) const;
+    std::optional<int> RequestContext::convert_string<int>(std::string_view value) const;
+
+    template <>
+    std::optional<long> RequestContext::convert_string<long>(std::string_view value) const;
 
     template <>
-    std::optional<long> RequestContext::convert_string<long>(const std::string& value) const;
+    std::optional<double> RequestContext::convert_string<double>(std::string_view value) const;
 
     template <>
-    std::optional<double> RequestContext::convert_string<double>(const std::string& value) const;
+    std::optional<std::string> RequestContext::convert_string<std::string>(std::string_view value) const;
 
     template <>
-    std::optional<std::string> RequestContext::convert_string<std::string>(const std::string& value) const;
+    std::optional<std::string_view> RequestContext::convert_string<std::string_view>(std::string_view value) const;
 
 }  // namespace demiplane::http
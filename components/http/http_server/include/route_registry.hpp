@@ -2,39 +2,44 @@
 
 #include <demiplane/nexus>
 #include <demiplane/scroll>
-#include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <boost/unordered/unordered_flat_map.hpp>
 
 #include "aliases.hpp"
+#include "route_trie.hpp"
 
 namespace demiplane::http {
 
     struct RouteInfo {
         boost::beast::http::verb method = boost::beast::http::verb::unknown;
         std::string path;
-        std::string pattern;
-        std::vector<std::string> param_names;
         ContextHandler handler;
-        bool is_parametric                         = false;
-        std::shared_ptr<std::regex> compiled_regex = nullptr;
     };
 
     class RouteRegistry {
     public:
         NEXUS_REGISTER(nexus::Resettable);  // CRC32/ISO-HDLC of demiplane::http::RouteRegistry
 
+        /**
+         * @brief Registers a route; `{name}` marks a parameter spanning one path segment
+         * @throws std::invalid_argument on a malformed pattern (see RouteTrie::insert)
+         */
         void add_route(boost::beast::http::verb method, std::string path, ContextHandler handler);
 
         // Merge another registry into this one
         void merge(RouteRegistry&& other);
         void merge(const RouteRegistry& other);
 
-        [[nodiscard]] std::pair<ContextHandler, std::unordered_map<std::string, std::string>>
-        find_handler(boost::beast::http::verb method, const std::string& path) const;
+        /**
+         * @brief Resolves a request path without allocating
+         *
+         * The returned handler pointer and parameter names are valid until the registry changes,
+         * parameter values view into @p path.
+         */
+        [[nodiscard]] RouteMatch match(boost::beast::http::verb method, std::string_view path) const noexcept;
 
         [[nodiscard]] size_t route_count() const;
         void clear();
@@ -51,13 +56,11 @@ namespace demiplane::http {
     private:
         SCROLL_COMPONENT_PREFIX("RouteRegistry");
 
-        boost::unordered::unordered_flat_map<std::string, ContextHandler> exact_routes_;
-        std::vector<RouteInfo> parametric_routes_;
+        // Registered routes in insertion order; the tries are rebuilt from them on copy
+        std::vector<RouteInfo> routes_;
+        boost::unordered::unordered_flat_map<boost::beast::http::verb, RouteTrie> tries_;
 
-        [[nodiscard]] static std::string make_route_key(boost::beast::http::verb method, const std::string& path);
-        static RouteInfo
-        create_parametric_route(boost::beast::http::verb method, std::string path, ContextHandler handler);
-        [[nodiscard]] static bool is_parametric_path(const std::string& path);
+        void rebuild_tries();
     };
 
 }  // namespace demiplane::http
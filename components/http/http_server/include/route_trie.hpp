@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "aliases.hpp"
+
+namespace demiplane::http {
+
+    /// Upper bound of `{param}` segments in one route; add_route rejects longer patterns
+    inline constexpr std::size_t max_path_params = 8;
+
+    struct PathParam {
+        std::string_view name;
+        std::string_view value;
+    };
+
+    /**
+     * @brief Fixed-capacity set of matched path parameters
+     *
+     * Names view into the routing tree, values view into the matched path: both stay valid
+     * while the registry is unchanged and the request target is alive.
+     */
+    class PathParams {
+    public:
+        [[nodiscard]] std::optional<std::string_view> get(const std::string_view name) const noexcept {
+            for (std::size_t i = 0; i < size_; ++i) {
+                if (items_[i].name == name) {
+                    return items_[i].value;
+                }
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] const PathParam* begin() const noexcept {
+            return items_.data();
+        }
+        [[nodiscard]] const PathParam* end() const noexcept {
+            return items_.data() + size_;
+        }
+        [[nodiscard]] std::size_t size() const noexcept {
+            return size_;
+        }
+        [[nodiscard]] bool empty() const noexcept {
+            return size_ == 0;
+        }
+
+    private:
+        friend class RouteTrie;
+        friend class RequestContext;  // rebinds values when a context is copied
+
+        std::array<PathParam, max_path_params> items_{};
+        std::size_t size_ = 0;
+    };
+
+    struct RouteMatch {
+        const ContextHandler* handler = nullptr;
+        PathParams params;
+
+        explicit operator bool() const noexcept {
+            return handler != nullptr;
+        }
+    };
+
+    /**
+     * @brief Compressed radix tree of the routes of one HTTP method
+     *
+     * Static text is stored on edges, `{name}` is a dedicated child that consumes one
+     * non-empty path segment. Static edges win over parameters; the matcher backtracks
+     * into the parameter child when the static branch dead-ends.
+     * Matching does not allocate.
+     */
+    class RouteTrie {
+    public:
+        RouteTrie();
+        ~RouteTrie();
+
+        RouteTrie(RouteTrie&&) noexcept;
+        RouteTrie& operator=(RouteTrie&&) noexcept;
+
+        RouteTrie(const RouteTrie&)            = delete;
+        RouteTrie& operator=(const RouteTrie&) = delete;
+
+        /**
+         * @brief Adds a pattern, replacing the handler of an identical one
+         * @return true if an existing handler was replaced
+         * @throws std::invalid_argument if a parameter does not span a whole segment, is unnamed,
+         *         conflicts with a differently named parameter at the same position,
+         *         or the pattern has more than max_path_params parameters
+         */
+        bool insert(std::string_view pattern, ContextHandler handler);
+
+        [[nodiscard]] const ContextHandler* match(std::string_view path, PathParams& params) const noexcept;
+
+    private:
+        struct Node;
+
+        /// Static text of a pattern, or the name of one of its `{name}` parameters
+        struct Piece {
+            std::string_view text;
+            bool param;
+        };
+
+        std::unique_ptr<Node> root_;
+
+        /// @throws std::invalid_argument as insert() does, except for conflicts with the tree
+        static std::vector<Piece> parse_pattern(std::string_view pattern);
+        /// Node reached by exactly @p text from @p parent, nullptr if inserting it would add or split one
+        static const Node* follow_static(const Node& parent, std::string_view text) noexcept;
+        static Node* insert_static(Node& parent, std::string_view text);
+        static const ContextHandler* match_node(const Node& node, std::string_view path, PathParams& params) noexcept;
+    };
+
+}  // namespace demiplane::http
@@ -2,24 +2,51 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
+#include <demiplane/gears>
 #include <demiplane/nexus>
 #include <demiplane/scroll>
 #include <memory>
 #include <vector>
 
 #include <boost/asio/io_context.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
 
 #include "aliases.hpp"
 #include "controller.hpp"
+#include "firewall.hpp"
 #include "route_registry.hpp"
+#include "router_config.hpp"
+#include "static_response.hpp"
+#include "stream_exchange.hpp"
 
 namespace demiplane::http {
 
+    /**
+     * @brief How Server spreads connections over its threads
+     *
+     * Shared: one io_context run by every thread, one acceptor.
+     * Sharded: one single-threaded io_context per thread, each pinned to a core with its own
+     * SO_REUSEPORT acceptor; the kernel balances connections and a connection never leaves its
+     * shard. The thread calling run() then only serves signals and server callbacks.
+     */
+    enum class ServerMode : std::uint8_t { Shared, Sharded };
+
+    /**
+     * @brief Connections closed by a session deadline, per phase (Server::timeout_stats())
+     */
+    struct TimeoutStats {
+        std::uint64_t handshake = 0;  // no first byte after accept
+        std::uint64_t header    = 0;  // request headers incomplete
+        std::uint64_t body      = 0;  // request body or response write incomplete
+        std::uint64_t idle      = 0;  // keep-alive connection without a next request
+    };
+
     class Server {
     public:
         NEXUS_REGISTER(nexus::Immortal);
 
-        explicit Server(std::size_t threads = 1);
+        explicit Server(std::size_t threads = 1, ServerMode mode = ServerMode::Shared);
         ~Server();
 
         // Controller management - Server only handles processing
@@ -44,6 +71,29 @@ namespace demiplane::http {
         void on_error_async(AsyncErrorCallback callback);
 
 
+        /// Per-phase session deadlines; call before listen()
+        void set_timeouts(const timeouts& to);
+        [[nodiscard]] TimeoutStats timeout_stats() const noexcept;
+
+        /// Requests of one connection handled concurrently; responses still go out in order.
+        /// 1 (the default) handles them one after another; call before listen()
+        void set_pipeline_depth(std::size_t depth);
+
+        /// GET/HEAD of exactly @p path (query ignored) answered with @p response. No handler,
+        /// middleware or request/response callback runs for it; call before listen()
+        void add_static_route(std::string path, StaticResponse response);
+
+        /// @p method requests for exactly @p path (query ignored) handed to @p handler with the
+        /// connection: it reads the body and writes the response itself. No middleware or
+        /// request/response callback runs for it; call before listen()
+        void add_stream_route(boost::beast::http::verb method, std::string path, StreamHandler handler);
+
+        /// IP rules checked on every accepted connection; call before listen()
+        void set_ip_rules(const std::vector<ip_rule>& rules);
+        [[nodiscard]] const Firewall* firewall() const noexcept {
+            return firewall_.get();
+        }
+
         // Server lifecycle
         void listen(uint16_t port);
         void run();
@@ -54,11 +104,25 @@ namespace demiplane::http {
 
         mutable boost::asio::io_context ioc_;
         std::size_t thread_count_;
+        std::vector<std::unique_ptr<boost::asio::io_context>> shards_;  // empty in shared mode
         RouteRegistry registry_;  // Single registry for all routes
         std::vector<Middleware> middlewares_;
         std::vector<std::shared_ptr<HttpController>> controllers_;
         std::atomic<bool> running_{false};
 
+        timeouts timeouts_;
+        mutable std::atomic<std::uint64_t> handshake_timeouts_{0};
+        mutable std::atomic<std::uint64_t> header_timeouts_{0};
+        mutable std::atomic<std::uint64_t> body_timeouts_{0};
+        mutable std::atomic<std::uint64_t> idle_timeouts_{0};
+
+        std::size_t pipeline_depth_ = 1;
+        std::unique_ptr<Firewall> firewall_;  // null without rules
+        boost::unordered_flat_map<std::string, StaticResponse, gears::StringHash, gears::StringEqual> static_routes_;
+        using StreamRoutes =
+            boost::unordered_flat_map<std::string, StreamHandler, gears::StringHash, gears::StringEqual>;
+        boost::unordered_flat_map<boost::beast::http::verb, StreamRoutes> stream_routes_;
+
         // Callbacks
         std::vector<ServerCallback> start_callbacks_;
         std::vector<ServerCallback> stop_callbacks_;
@@ -74,11 +138,15 @@ namespace demiplane::http {
         std::vector<AsyncResponseCallback> async_response_callbacks_;
         std::vector<AsyncErrorCallback> async_error_callbacks_;
 
-        [[nodiscard]] boost::asio::awaitable<void> session(boost::asio::ip::tcp::socket socket) const;
+        [[nodiscard]] boost::asio::awaitable<void> accept_loop(uint16_t port, bool reuse_port);
+        [[nodiscard]] boost::asio::awaitable<void> expire_firewall_state();
+        [[nodiscard]] boost::asio::awaitable<void> session(boost::asio::ip::tcp::socket socket,
+                                                           Firewall::Lease lease) const;
         [[nodiscard]] AsyncResponse handle_request(Request request) const;
+        [[nodiscard]] const StaticResponse* find_static(const Request& request) const noexcept;
+        [[nodiscard]] const StreamHandler* find_stream_route(const Request& request) const noexcept;
 
         void merge_controller_routes(HttpController* controller);
-        static std::unordered_map<std::string, std::string> parse_query_params(const std::string& query);
 
         // Callback triggers (non-blocking)
         void trigger_start_callbacks() const;
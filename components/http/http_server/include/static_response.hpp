@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <boost/asio/buffer.hpp>
+
+#include "aliases.hpp"
+
+namespace demiplane::http {
+
+    /**
+     * @brief Response of a fixed endpoint, serialized once
+     *
+     * Status line, headers and body are rendered at construction and later written as they are
+     * with scatter-gather I/O: no handler runs and the Beast serializer is skipped. The body gets
+     * a strong ETag, so a request naming it in If-None-Match is answered with a pre-rendered 304.
+     * The rendered form is HTTP/1.1 keep-alive; other requests are served through to_response().
+     */
+    class StaticResponse {
+    public:
+        explicit StaticResponse(boost::beast::http::status status,
+                                std::string body              = "",
+                                std::string_view content_type = "text/plain");
+
+        [[nodiscard]] std::string_view etag() const noexcept {
+            return etag_;
+        }
+
+        /// True if the If-None-Match value @p if_none_match is `*` or lists this ETag (weak comparison)
+        [[nodiscard]] bool not_modified(std::string_view if_none_match) const noexcept;
+
+        /// True if the GET/HEAD @p request can be answered with the pre-rendered bytes
+        [[nodiscard]] static bool fits(const Request& request) noexcept;
+
+        /// Bytes answering @p request: the 304, the head alone for HEAD, or head and body
+        [[nodiscard]] std::array<boost::asio::const_buffer, 2> answer(const Request& request) const noexcept;
+
+        /// The same answer as a Beast message, for requests that do not fit()
+        [[nodiscard]] Response to_response(const Request& request) const;
+
+    private:
+        Response prototype_;  // also owns the body the buffers point at
+        std::string etag_;
+        std::string head_;
+        std::string not_modified_head_;
+
+        [[nodiscard]] bool revalidates(const Request& request) const noexcept;
+    };
+
+}  // namespace demiplane::http
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+
+#include "aliases.hpp"
+
+namespace demiplane::http {
+
+    /**
+     * @brief One request/response exchange handed to a StreamHandler
+     *
+     * The handler gets the request head at once and pulls the body with read_body(): nothing
+     * more is read from the socket than it asks for, so a slow consumer slows the client down
+     * instead of buffering the upload. The response is either a regular one (send()), chunked
+     * (begin_chunked(), write_chunk(), end_chunked()) or a file (send_file(), through sendfile(2)
+     * on Linux unless it is small). Every socket operation gets the body deadline.
+     * The connection is kept alive only if the body was read to the end and a complete response
+     * went out.
+     */
+    class StreamExchange {
+    public:
+        using RequestHeader = boost::beast::http::request_header<RequestFields>;
+        using BodyParser    = boost::beast::http::request_parser<boost::beast::http::buffer_body, RequestAllocator>;
+
+        StreamExchange(boost::beast::tcp_stream& stream,
+                       boost::beast::flat_buffer& buffer,
+                       BodyParser& parser,
+                       std::chrono::milliseconds deadline) noexcept;
+
+        [[nodiscard]] const RequestHeader& request() const noexcept {
+            return parser_.get().base();
+        }
+
+        /// Reads the next piece of the body into @p into; 0 once the body is complete
+        [[nodiscard]] boost::asio::awaitable<std::size_t> read_body(boost::asio::mutable_buffer into);
+
+        /// Whole response at once
+        [[nodiscard]] AsyncVoid send(Response response);
+
+        /// Starts a `Transfer-Encoding: chunked` response; empty chunks are skipped
+        [[nodiscard]] AsyncVoid begin_chunked(boost::beast::http::status status, std::string_view content_type);
+        [[nodiscard]] AsyncVoid write_chunk(boost::asio::const_buffer data);
+        [[nodiscard]] AsyncVoid end_chunked();
+
+        /// 200 with the content of @p path, or 404 if it cannot be opened
+        [[nodiscard]] AsyncVoid send_file(const std::string& path,
+                                          std::string_view content_type = "application/octet-stream");
+
+        [[nodiscard]] bool started() const noexcept {
+            return state_ != ResponseState::None;
+        }
+        [[nodiscard]] bool responded() const noexcept {
+            return state_ == ResponseState::Complete;
+        }
+        [[nodiscard]] bool keep_alive() const noexcept;
+
+    private:
+        enum class ResponseState : std::uint8_t { None, Chunked, Complete };
+
+        boost::beast::tcp_stream& stream_;
+        boost::beast::flat_buffer& buffer_;
+        BodyParser& parser_;
+        std::chrono::milliseconds deadline_;
+        ResponseState state_      = ResponseState::None;
+        bool response_keep_alive_ = true;
+        bool chunked_             = true;  // false for HTTP/1.0, where the body ends with the connection
+
+        void expect_no_response() const;
+        [[nodiscard]] AsyncVoid write_header(boost::beast::http::response<boost::beast::http::empty_body>& head);
+#if defined(__linux__)
+        [[nodiscard]] AsyncVoid sendfile_body(boost::beast::http::file_body::value_type& file);
+#endif
+    };
+
+}  // namespace demiplane::http
@@ -0,0 +1,243 @@
+#include "firewall.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <boost/container_hash/hash.hpp>
+
+namespace demiplane::http {
+
+    struct Firewall::ClientState {
+        explicit ClientState(const rate_limit& rule) noexcept
+            : limits{rule} {
+        }
+
+        const rate_limit& limits;
+        std::atomic<std::int64_t> tat{0};        // theoretical arrival time of the next request, steady ns
+        std::atomic<std::uint32_t> in_flight{0};  // admitted connections not closed yet
+
+        /// Takes one token at @p time (steady ns); false if the client is over its rate
+        bool take(const std::int64_t time) noexcept {
+            if (limits.req_per_sec == 0) {
+                return true;
+            }
+            // GCRA: every request pushes the arrival time one interval further; a client may run
+            // at most burst + 1 intervals ahead of the clock
+            const std::int64_t interval = std::nano::den / limits.req_per_sec;
+            const std::int64_t ahead    = interval * (std::int64_t{limits.burst} + 1);
+
+            auto expected = tat.load(std::memory_order_relaxed);
+            while (true) {
+                const auto next = std::max(expected, time) + interval;
+                if (next - time > ahead) {
+                    return false;
+                }
+                if (tat.compare_exchange_weak(expected, next, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        }
+    };
+
+    namespace {
+        using AddressKey = std::array<std::uint8_t, 16>;
+
+        // IPv4 is keyed as ::ffff:a.b.c.d, so its prefixes sit 96 bits deep in the trie
+        constexpr std::size_t v4_mapped_offset = 96;
+
+        AddressKey to_key(const boost::asio::ip::address& address) noexcept {
+            if (address.is_v4()) {
+                return boost::asio::ip::make_address_v6(boost::asio::ip::v4_mapped, address.to_v4()).to_bytes();
+            }
+            return address.to_v6().to_bytes();
+        }
+
+        std::size_t bit(const AddressKey& key, const std::size_t index) noexcept {
+            return static_cast<std::size_t>(key[index / 8] >> (7 - index % 8)) & 1u;
+        }
+
+        /// "10.0.0.0/8", "::1/128"; a bare address is a single host
+        std::pair<AddressKey, std::size_t> parse_cidr(const std::string_view cidr) {
+            const auto slash = cidr.find('/');
+
+            boost::system::error_code ec;
+            const auto address = boost::asio::ip::make_address(std::string{cidr.substr(0, slash)}, ec);
+            if (ec) {
+                throw std::invalid_argument("Malformed address in CIDR " + std::string{cidr});
+            }
+
+            const std::size_t width = address.is_v4() ? 32 : 128;
+            std::size_t prefix      = width;
+            if (slash != std::string_view::npos) {
+                const auto length     = cidr.substr(slash + 1);
+                const auto* const end = length.data() + length.size();
+                if (const auto [ptr, err] = std::from_chars(length.data(), end, prefix);
+                    err != std::errc{} || ptr != end || length.empty() || prefix > width) {
+                    throw std::invalid_argument("Malformed prefix length in CIDR " + std::string{cidr});
+                }
+            }
+            return {to_key(address), address.is_v4() ? prefix + v4_mapped_offset : prefix};
+        }
+
+        bool blocks(const rate_limit& limits) noexcept {
+            return limits.max_in_flight == 0 && limits.req_per_sec == 0 && limits.burst == 0;
+        }
+
+        std::int64_t to_nanoseconds(const Firewall::Clock::time_point time) noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        }
+    }  // namespace
+
+    // Lease
+
+    Firewall::Lease::~Lease() {
+        if (state_) {
+            state_->in_flight.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    Firewall::Lease::Lease(Lease&& other) noexcept
+        : state_{std::exchange(other.state_, nullptr)},
+          prepaid_{std::exchange(other.prepaid_, false)} {
+    }
+
+    Firewall::Lease& Firewall::Lease::operator=(Lease&& other) noexcept {
+        if (this != &other) {
+            if (state_) {
+                state_->in_flight.fetch_sub(1, std::memory_order_release);
+            }
+            state_   = std::exchange(other.state_, nullptr);
+            prepaid_ = std::exchange(other.prepaid_, false);
+        }
+        return *this;
+    }
+
+    bool Firewall::Lease::charge(const Clock::time_point now) noexcept {
+        if (std::exchange(prepaid_, false)) {
+            return true;
+        }
+        return !state_ || state_->take(to_nanoseconds(now));
+    }
+
+    // Firewall
+
+    Firewall::Firewall(const std::vector<ip_rule>& rules)
+        : nodes_(1) {
+        rules_.reserve(rules.size());
+        for (const auto& [cidr, limits] : rules) {
+            const auto [key, prefix_length] = parse_cidr(cidr);
+            rules_.push_back(limits);
+            insert(key, prefix_length, rules_.size() - 1);
+        }
+    }
+
+    Firewall::~Firewall() = default;
+
+    void Firewall::insert(const AddressKey& key, const std::size_t prefix_length, const std::size_t rule) {
+        std::size_t node = 0;
+        for (std::size_t i = 0; i < prefix_length; ++i) {
+            const auto side = bit(key, i);
+            if (nodes_[node].children[side] < 0) {
+                nodes_[node].children[side] = static_cast<std::int32_t>(nodes_.size());
+                nodes_.emplace_back();
+            }
+            node = static_cast<std::size_t>(nodes_[node].children[side]);
+        }
+        nodes_[node].rule = static_cast<std::int32_t>(rule);
+    }
+
+    const rate_limit* Firewall::match(const boost::asio::ip::address& address) const noexcept {
+        return match(to_key(address));
+    }
+
+    const rate_limit* Firewall::match(const AddressKey& key) const noexcept {
+        std::int32_t rule = nodes_[0].rule;
+        std::size_t node  = 0;
+        for (std::size_t i = 0; i < key.size() * 8; ++i) {
+            const auto child = nodes_[node].children[bit(key, i)];
+            if (child < 0) {
+                break;
+            }
+            node = static_cast<std::size_t>(child);
+            if (nodes_[node].rule >= 0) {
+                rule = nodes_[node].rule;
+            }
+        }
+        return rule >= 0 ? &rules_[static_cast<std::size_t>(rule)] : nullptr;
+    }
+
+    Firewall::Shard& Firewall::shard_of(const AddressKey& key) noexcept {
+        return shards_[boost::hash<AddressKey>{}(key) % shard_count];
+    }
+
+    std::optional<Firewall::Lease> Firewall::admit(const boost::asio::ip::address& address,
+                                                   const Clock::time_point now) {
+        if (rules_.empty()) {
+            return Lease{};
+        }
+        const auto key           = to_key(address);
+        const rate_limit* limits = match(key);
+        if (!limits) {
+            return Lease{};
+        }
+        if (blocks(*limits)) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        if (limits->max_in_flight == 0 && limits->req_per_sec == 0) {
+            return Lease{};  // a burst without a rate limits nothing
+        }
+
+        // The shard lock only covers the lookup and pinning the state; the lease keeps it alive
+        // for expire(), so the bucket below is updated without any lock
+        Lease lease;
+        {
+            auto& shard = shard_of(key);
+            std::scoped_lock lock{shard.mutex};
+            auto& state = shard.clients[key];
+            if (!state) {
+                state = std::make_unique<ClientState>(*limits);
+            }
+            if (limits->max_in_flight != 0 &&
+                state->in_flight.load(std::memory_order_relaxed) >= limits->max_in_flight) {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            state->in_flight.fetch_add(1, std::memory_order_relaxed);
+            lease = Lease{state.get()};
+        }
+
+        if (!lease.state_->take(to_nanoseconds(now))) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        lease.prepaid_ = true;
+        return lease;
+    }
+
+    void Firewall::expire(const Clock::time_point now) {
+        const std::int64_t time = to_nanoseconds(now);
+        for (auto& shard : shards_) {
+            std::scoped_lock lock{shard.mutex};
+            boost::unordered::erase_if(shard.clients, [time](const auto& entry) {
+                const auto& state = *entry.second;
+                return state.in_flight.load(std::memory_order_acquire) == 0 &&
+                       state.tat.load(std::memory_order_relaxed) <= time;
+            });
+        }
+    }
+
+    std::size_t Firewall::tracked_clients() const {
+        std::size_t count = 0;
+        for (const auto& shard : shards_) {
+            std::scoped_lock lock{shard.mutex};
+            count += shard.clients.size();
+        }
+        return count;
+    }
+
+}  // namespace demiplane::http
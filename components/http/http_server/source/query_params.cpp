@@ -0,0 +1,143 @@
+#include "query_params.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace demiplane::http {
+    namespace {
+        constexpr int hex_value(const char c) noexcept {
+            if (c >= '0' && c <= '9') {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'f') {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'F') {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+
+        // string_view::find is memchr underneath, which libc vectorizes
+        bool has_escapes(const std::string_view text) noexcept {
+            return text.find('%') != std::string_view::npos || text.find('+') != std::string_view::npos;
+        }
+
+        /// Decodes @p text at @p out and advances it; text without escapes is returned as is
+        std::string_view decode(const std::string_view text, char*& out) noexcept {
+            if (!has_escapes(text)) {
+                return text;
+            }
+
+            char* const begin = out;
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                if (text[i] == '+') {
+                    *out++ = ' ';
+                    continue;
+                }
+                if (text[i] == '%' && i + 2 < text.size()) {
+                    const int hi = hex_value(text[i + 1]);
+                    const int lo = hex_value(text[i + 2]);
+                    if (hi >= 0 && lo >= 0) {
+                        *out++ = static_cast<char>(hi * 16 + lo);
+                        i += 2;
+                        continue;
+                    }
+                }
+                // Malformed escapes are kept literally
+                *out++ = text[i];
+            }
+            return {begin, static_cast<std::size_t>(out - begin)};
+        }
+    }  // namespace
+
+    QueryParams::QueryParams(std::pmr::memory_resource* resource)
+        : items_(resource),
+          decoded_(resource) {
+    }
+
+    QueryParams::QueryParams(const QueryParams& other)
+        : items_(other.items_),
+          decoded_(other.decoded_) {
+        rebind_decoded(other.decoded_.data());
+    }
+
+    QueryParams& QueryParams::operator=(const QueryParams& other) {
+        if (this != &other) {
+            items_   = other.items_;
+            decoded_ = other.decoded_;
+            rebind_decoded(other.decoded_.data());
+        }
+        return *this;
+    }
+
+    QueryParams& QueryParams::operator=(QueryParams&& other) {
+        if (this != &other) {
+            // Unequal resources make the vectors copy element-wise instead of stealing the buffer
+            const char* from = other.decoded_.data();
+            items_           = std::move(other.items_);
+            decoded_         = std::move(other.decoded_);
+            rebind_decoded(from);
+        }
+        return *this;
+    }
+
+    void QueryParams::rebind_decoded(const char* from) noexcept {
+        if (decoded_.empty() || from == decoded_.data()) {
+            return;
+        }
+        constexpr std::less_equal<const char*> le;
+        for (auto& [key, value] : items_) {
+            for (auto* view : {&key, &value}) {
+                if (le(from, view->data()) && le(view->data() + view->size(), from + decoded_.size())) {
+                    *view = {decoded_.data() + (view->data() - from), view->size()};
+                }
+            }
+        }
+    }
+
+    QueryParams QueryParams::parse(std::string_view query, std::pmr::memory_resource* resource) {
+        QueryParams params{resource};
+        if (query.empty()) {
+            return params;
+        }
+
+        params.items_.reserve(static_cast<std::size_t>(std::ranges::count(query, '&')) + 1);
+        char* out = nullptr;
+        if (has_escapes(query)) {
+            // Decoding never grows the text, so one buffer of the input size fits every pair
+            params.decoded_.resize(query.size());
+            out = params.decoded_.data();
+        }
+
+        while (!query.empty()) {
+            const auto amp  = query.find('&');
+            const auto pair = query.substr(0, amp);
+            query           = amp != std::string_view::npos ? query.substr(amp + 1) : std::string_view{};
+            if (pair.empty()) {
+                continue;
+            }
+
+            const auto eq = pair.find('=');
+            auto key      = pair.substr(0, eq);
+            auto value    = eq != std::string_view::npos ? pair.substr(eq + 1) : std::string_view{};
+            if (out) {
+                key   = decode(key, out);
+                value = decode(value, out);
+            }
+            params.items_.emplace_back(key, value);
+        }
+        if (out) {
+            params.decoded_.resize(static_cast<std::size_t>(out - params.decoded_.data()));
+        }
+        return params;
+    }
+
+    std::optional<std::string_view> QueryParams::get(const std::string_view name) const noexcept {
+        if (const auto it = std::ranges::find(items_, name, &QueryParam::first); it != items_.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+}  // namespace demiplane::http
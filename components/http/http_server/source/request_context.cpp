@@ -1,34 +1,74 @@
 #include "request_context.hpp"
 
-#include <algorithm>
+#include <charconv>
 #include <demiplane/gears>
-#include <sstream>
+#include <functional>
+#include <memory>
 
 namespace demiplane::http {
+    namespace {
+        /// Moves a view into @p from to the same offset in @p to; views elsewhere are kept
+        std::string_view rebase(const std::string_view view, const std::string_view from, const std::string_view to) {
+            constexpr std::less_equal<const char*> le;
+            if (le(from.data(), view.data()) && le(view.data() + view.size(), from.data() + from.size())) {
+                return to.substr(static_cast<std::size_t>(view.data() - from.data()), view.size());
+            }
+            return view;
+        }
+    }  // namespace
+
     RequestContext::RequestContext(Request req)
         : request_(std::move(req)) {
-        parse_headers();
     }
 
-    void RequestContext::parse_headers() {
-        for (const auto& field : request_) {
-            auto name        = std::string(field.name_string());
-            const auto value = std::string(field.value());
-            std::ranges::transform(name, name.begin(), ::tolower);
-            headers_[name] = value;
+    RequestContext::RequestContext(const RequestContext& other)
+        : request_(other.request_),
+          cached_json_(other.cached_json_),
+          cached_form_data_(other.cached_form_data_),
+          cached_multipart_data_(other.cached_multipart_data_),
+          path_params_(other.path_params_),
+          query_params_(other.query_params_) {
+        rebind_params(other.target());
+    }
+
+    RequestContext& RequestContext::operator=(const RequestContext& other) {
+        if (this != &other) {
+            request_               = other.request_;
+            cached_json_           = other.cached_json_;
+            cached_form_data_      = other.cached_form_data_;
+            cached_multipart_data_ = other.cached_multipart_data_;
+            path_params_           = other.path_params_;
+            query_params_          = other.query_params_;
+            rebind_params(other.target());
         }
+        return *this;
     }
 
-    std::string RequestContext::path_only() const {
-        auto target_str      = target();
-        const auto query_pos = target_str.find('?');
-        return query_pos != std::string::npos ? target_str.substr(0, query_pos) : target_str;
+    void RequestContext::rebind_params(const std::string_view from) noexcept {
+        const auto to = target();
+        if (from.data() == to.data()) {
+            return;
+        }
+        for (std::size_t i = 0; i < path_params_.size_; ++i) {
+            path_params_.items_[i].value = rebase(path_params_.items_[i].value, from, to);
+        }
+        if (query_params_) {
+            for (auto& [name, value] : query_params_->items_) {
+                name  = rebase(name, from, to);
+                value = rebase(value, from, to);
+            }
+        }
     }
 
-    std::string RequestContext::query_string() const {
+    std::string_view RequestContext::path_only() const {
+        const auto target_str = target();
+        return target_str.substr(0, target_str.find('?'));
+    }
+
+    std::string_view RequestContext::query_string() const {
         const auto target_str = target();
         const auto query_pos  = target_str.find('?');
-        return query_pos != std::string::npos ? target_str.substr(query_pos + 1) : "";
+        return query_pos != std::string_view::npos ? target_str.substr(query_pos + 1) : std::string_view{};
     }
 
     bool RequestContext::is_json() const {
@@ -67,10 +107,9 @@ namespace demiplane::http {
         Json::Value root;
         std::string errors;
 
-        const auto body_str = body();
-        std::istringstream stream(body_str);
-
-        if (const Json::CharReaderBuilder builder; !Json::parseFromStream(builder, stream, &root, &errors)) {
+        const Json::CharReaderBuilder builder;
+        const std::unique_ptr<Json::CharReader> reader{builder.newCharReader()};
+        if (const auto text = body(); !reader->parse(text.data(), text.data() + text.size(), &root, &errors)) {
             throw std::runtime_error("Failed to parse JSON: " + errors);
         }
 
@@ -96,21 +135,9 @@ namespace demiplane::http {
 
     std::unordered_map<std::string, std::string> RequestContext::parse_form_data_body() const {
         std::unordered_map<std::string, std::string> data;
-        const auto body_str = body();
-
-        std::istringstream stream(body_str);
-        std::string pair;
-
-        while (std::getline(stream, pair, '&')) {
-            if (const auto eq_pos = pair.find('='); eq_pos != std::string::npos) {
-                auto key         = pair.substr(0, eq_pos);
-                const auto value = pair.substr(eq_pos + 1);
-
-                // URL decode key and value here if needed
-                data[key] = value;
-            }
+        for (const auto& [key, value] : QueryParams::parse(body())) {
+            data.insert_or_assign(std::string{key}, std::string{value});
         }
-
         return data;
     }
 
@@ -148,10 +175,9 @@ namespace demiplane::http {
             return fields;
         }
 
-        std::string boundary = "--" + content_type->substr(boundary_pos + 9);
+        std::string boundary = "--" + std::string{content_type->substr(boundary_pos + 9)};
 
         // Parse multipart data (simplified)
-        const auto body_str = body();
         // Implementation would split by boundary and parse each part
         // This is complex and would typically use a library like cpp-httplib's multipart parser
 
@@ -180,69 +206,76 @@ namespace demiplane::http {
         return "text/plain";
     }
 
-    std::optional<std::string> RequestContext::header(const std::string_view name) const {
-        std::string lower_name{name};
-        std::ranges::transform(lower_name, lower_name.begin(), ::tolower);
-
-        if (const auto it = headers_.find(lower_name); it != headers_.end()) {
-            return it->second;
+    std::optional<std::string_view> RequestContext::header(const std::string_view name) const {
+        // Beast compares field names case-insensitively
+        if (const auto it = request_.find({name.data(), name.size()}); it != request_.end()) {
+            const auto value = it->value();
+            return std::string_view{value.data(), value.size()};
         }
         return std::nullopt;
     }
 
-    std::string RequestContext::header_or(const std::string_view name, const std::string_view default_value) const {
-        if (auto value = header(name)) {
-            return *value;
-        }
-        return std::string{default_value};
+    std::string_view RequestContext::header_or(const std::string_view name,
+                                               const std::string_view default_value) const {
+        return header(name).value_or(default_value);
     }
 
-    void RequestContext::set_path_params(std::unordered_map<std::string, std::string> params) {
-        path_params_ = std::move(params);
+    void RequestContext::set_path_params(const PathParams& params) {
+        path_params_ = params;
     }
 
-    void RequestContext::set_query_params(std::unordered_map<std::string, std::string> params) {
-        query_params_ = std::move(params);
+    const QueryParams& RequestContext::query_params() const {
+        if (!query_params_.has_value()) {
+            query_params_ = QueryParams::parse(query_string(), request_.get_allocator().resource());
+        }
+        return *query_params_;
     }
 
     // Template specializations
-    template <>
-    std::optional<int> RequestContext::convert_string<int>(const std::string& value) const {
-        try {
-            return std::stoi(value);
-        } catch (...) {
-            return std::nullopt;
+    namespace {
+        // Whole-view conversion: trailing garbage ("12abc") is a failure, not 12
+        template <typename T>
+        std::optional<T> parse_number(const std::string_view value) {
+            T result{};
+            const auto* const end = value.data() + value.size();
+            if (const auto [ptr, ec] = std::from_chars(value.data(), end, result); ec != std::errc{} || ptr != end) {
+                return std::nullopt;
+            }
+            return result;
         }
+    }  // namespace
+
+    template <>
+    std::optional<int> RequestContext::convert_string<int>(const std::string_view value) const {
+        return parse_number<int>(value);
     }
 
     template <>
-    std::optional<long> RequestContext::convert_string<long>(const std::string& value) const {
-        try {
-            return std::stol(value);
-        } catch (...) {
-            return std::nullopt;
-        }
+    std::optional<long> RequestContext::convert_string<long>(const std::string_view value) const {
+        return parse_number<long>(value);
     }
 
     template <>
-    std::optional<double> RequestContext::convert_string<double>(const std::string& value) const {
-        try {
-            return std::stod(value);
-        } catch (...) {
-            return std::nullopt;
-        }
+    std::optional<double> RequestContext::convert_string<double>(const std::string_view value) const {
+        return parse_number<double>(value);
+    }
+
+    template <>
+    std::optional<std::string> RequestContext::convert_string<std::string>(const std::string_view value) const {
+        return std::string{value};
     }
 
     template <>
-    std::optional<std::string> RequestContext::convert_string<std::string>(const std::string& value) const {
+    std::optional<std::string_view>
+    RequestContext::convert_string<std::string_view>(const std::string_view value) const {
         return value;
     }
 
     // Template method implementations
     template <typename T>
     std::optional<T> RequestContext::path(const std::string_view name) const {
-        if (const auto it = path_params_.find(std::string{name}); it != path_params_.end()) {
-            return convert_string<T>(it->second);
+        if (const auto value = path_params_.get(name)) {
+            return convert_string<T>(*value);
         }
         return std::nullopt;
     }
@@ -257,8 +290,8 @@ namespace demiplane::http {
 
     template <typename T>
     std::optional<T> RequestContext::query(const std::string_view name) const {
-        if (const auto it = query_params_.find(std::string{name}); it != query_params_.end()) {
-            return convert_string<T>(it->second);
+        if (const auto value = query_params().get(name)) {
+            return convert_string<T>(*value);
         }
         return std::nullopt;
     }
@@ -276,19 +309,23 @@ namespace demiplane::http {
     template std::optional<long> RequestContext::path<long>(std::string_view) const;
     template std::optional<double> RequestContext::path<double>(std::string_view) const;
     template std::optional<std::string> RequestContext::path<std::string>(std::string_view) const;
+    template std::optional<std::string_view> RequestContext::path<std::string_view>(std::string_view) const;
 
     template int RequestContext::path_or<int>(std::string_view, int) const;
     template long RequestContext::path_or<long>(std::string_view, long) const;
     template double RequestContext::path_or<double>(std::string_view, double) const;
     template std::string RequestContext::path_or<std::string>(std::string_view, std::string) const;
+    template std::string_view RequestContext::path_or<std::string_view>(std::string_view, std::string_view) const;
 
     template std::optional<int> RequestContext::query<int>(std::string_view) const;
     template std::optional<long> RequestContext::query<long>(std::string_view) const;
     template std::optional<double> RequestContext::query<double>(std::string_view) const;
     template std::optional<std::string> RequestContext::query<std::string>(std::string_view) const;
+    template std::optional<std::string_view> RequestContext::query<std::string_view>(std::string_view) const;
 
     template int RequestContext::query_or<int>(std::string_view, int) const;
     template long RequestContext::query_or<long>(std::string_view, long) const;
     template double RequestContext::query_or<double>(std::string_view, double) const;
     template std::string RequestContext::query_or<std::string>(std::string_view, std::string) const;
+    template std::string_view RequestContext::query_or<std::string_view>(std::string_view, std::string_view) const;
 }  // namespace demiplane::http
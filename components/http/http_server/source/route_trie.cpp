@@ -0,0 +1,177 @@
+#include "route_trie.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace demiplane::http {
+
+    struct RouteTrie::Node {
+        std::string prefix;                           // static text on the edge into this node
+        std::vector<std::unique_ptr<Node>> children;  // static children, distinct first characters
+        std::unique_ptr<Node> param;                  // `{name}` child
+        std::string param_name;                       // set on parameter nodes
+        ContextHandler handler;
+    };
+
+    RouteTrie::RouteTrie()
+        : root_{std::make_unique<Node>()} {
+    }
+
+    RouteTrie::~RouteTrie()                               = default;
+    RouteTrie::RouteTrie(RouteTrie&&) noexcept            = default;
+    RouteTrie& RouteTrie::operator=(RouteTrie&&) noexcept = default;
+
+    bool RouteTrie::insert(const std::string_view pattern, ContextHandler handler) {
+        // The whole pattern is checked before the tree changes, so a rejected route leaves no
+        // half-built branch behind: first its syntax, then its parameter names against the tree
+        const auto pieces = parse_pattern(pattern);
+
+        const Node* existing = root_.get();
+        for (const auto& [text, param] : pieces) {
+            if (!existing) {
+                break;  // past the existing branches everything is new, nothing to conflict with
+            }
+            if (!param) {
+                existing = follow_static(*existing, text);
+                continue;
+            }
+            if (existing->param && existing->param->param_name != text) {
+                throw std::invalid_argument("Parameter {" + std::string{text} + "} conflicts with {" +
+                                            existing->param->param_name + "} in route " + std::string{pattern});
+            }
+            existing = existing->param.get();
+        }
+
+        Node* node = root_.get();
+        for (const auto& [text, param] : pieces) {
+            if (!param) {
+                node = insert_static(*node, text);
+                continue;
+            }
+            if (!node->param) {
+                node->param             = std::make_unique<Node>();
+                node->param->param_name = text;
+            }
+            node = node->param.get();
+        }
+
+        const bool replaced = static_cast<bool>(node->handler);
+        node->handler       = std::move(handler);
+        return replaced;
+    }
+
+    const ContextHandler* RouteTrie::match(const std::string_view path, PathParams& params) const noexcept {
+        params.size_ = 0;
+        return match_node(*root_, path, params);
+    }
+
+    std::vector<RouteTrie::Piece> RouteTrie::parse_pattern(const std::string_view pattern) {
+        std::vector<Piece> pieces;
+        std::size_t pos     = 0;
+        std::size_t nparams = 0;
+
+        while (pos < pattern.size()) {
+            if (pattern[pos] != '{') {
+                const auto next = std::min(pattern.find('{', pos), pattern.size());
+                pieces.push_back(Piece{pattern.substr(pos, next - pos), false});
+                pos = next;
+                continue;
+            }
+
+            const auto close = pattern.find('}', pos);
+            if (close == std::string_view::npos || close == pos + 1) {
+                throw std::invalid_argument("Malformed parameter in route " + std::string{pattern});
+            }
+            if (pos == 0 || pattern[pos - 1] != '/' || (close + 1 < pattern.size() && pattern[close + 1] != '/')) {
+                throw std::invalid_argument("Parameter must span a whole path segment in route " +
+                                            std::string{pattern});
+            }
+            if (++nparams > max_path_params) {
+                throw std::invalid_argument("Too many parameters in route " + std::string{pattern});
+            }
+
+            pieces.push_back(Piece{pattern.substr(pos + 1, close - pos - 1), true});
+            pos = close + 1;
+        }
+        return pieces;
+    }
+
+    const RouteTrie::Node* RouteTrie::follow_static(const Node& parent, std::string_view text) noexcept {
+        const Node* node = &parent;
+        while (!text.empty()) {
+            const auto it = std::ranges::find_if(node->children, [&](const std::unique_ptr<Node>& child) {
+                return child->prefix.front() == text.front();
+            });
+            if (it == node->children.end() || !text.starts_with((*it)->prefix)) {
+                return nullptr;
+            }
+            node = it->get();
+            text.remove_prefix(node->prefix.size());
+        }
+        return node;
+    }
+
+    RouteTrie::Node* RouteTrie::insert_static(Node& parent, std::string_view text) {
+        Node* node = &parent;
+        while (!text.empty()) {
+            const auto it = std::ranges::find_if(node->children, [&](const std::unique_ptr<Node>& child) {
+                return child->prefix.front() == text.front();
+            });
+            if (it == node->children.end()) {
+                auto& leaf   = node->children.emplace_back(std::make_unique<Node>());
+                leaf->prefix = text;
+                return leaf.get();
+            }
+
+            Node& child       = **it;
+            const auto common = std::ranges::mismatch(child.prefix, text).in1;
+            const auto shared = static_cast<std::size_t>(common - child.prefix.begin());
+            if (shared < child.prefix.size()) {
+                // Split the edge: the shared part becomes a new node above the old child
+                auto split    = std::make_unique<Node>();
+                split->prefix = child.prefix.substr(0, shared);
+                child.prefix.erase(0, shared);
+                split->children.push_back(std::move(*it));
+                *it = std::move(split);
+            }
+            node = it->get();
+            text.remove_prefix(shared);
+        }
+        return node;
+    }
+
+    const ContextHandler*
+    RouteTrie::match_node(const Node& node, const std::string_view path, PathParams& params) noexcept {
+        if (path.empty()) {
+            return node.handler ? &node.handler : nullptr;
+        }
+
+        for (const auto& child : node.children) {
+            if (child->prefix.front() != path.front()) {
+                continue;
+            }
+            if (path.starts_with(child->prefix)) {
+                if (const auto* handler = match_node(*child, path.substr(child->prefix.size()), params)) {
+                    return handler;
+                }
+            }
+            break;
+        }
+
+        if (node.param) {
+            const auto segment_end = std::min(path.find('/'), path.size());
+            if (segment_end > 0) {
+                const auto saved              = params.size_;
+                params.items_[params.size_++] = {node.param->param_name, path.substr(0, segment_end)};
+                if (const auto* handler = match_node(*node.param, path.substr(segment_end), params)) {
+                    return handler;
+                }
+                params.size_ = saved;
+            }
+        }
+        return nullptr;
+    }
+
+}  // namespace demiplane::http
@@ -1,16 +1,30 @@
 #include "server.hpp"
 
+#include <algorithm>
+#include <array>
 #include <demiplane/gears>
 #include <demiplane/scroll>
+#include <deque>
+#include <limits>
+#include <memory_resource>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <thread>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/detached.hpp>
 #include <boost/asio/redirect_error.hpp>
 #include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/beast/core.hpp>
 
+#if defined(__linux__)
+    #include <pthread.h>
+#endif
+
 #include "request_context.hpp"
 #include "response_factory.hpp"
 
@@ -19,10 +33,76 @@ namespace demiplane::http {
     namespace asio  = boost::asio;
     using tcp       = asio::ip::tcp;
 
-    Server::Server(const std::size_t threads)
-        : ioc_(static_cast<int>(threads)),
+    namespace {
+        // Covers the fields and a small body of a typical request without touching the heap
+        constexpr std::size_t connection_arena_size = 16 * 1024;
+        // Heap a connection arena may take past its inline block before the session stops reading ahead
+        constexpr std::size_t arena_spill_limit = 4 * connection_arena_size;
+        // Upper bound of one read while waiting for a request to start, as Beast's own reads use
+        constexpr std::size_t read_chunk_limit = 64 * 1024;
+        // Body limit of buffered requests, Beast's default; stream routes read theirs without one
+        constexpr std::uint64_t request_body_limit = 1024 * 1024;
+
+        // How often per-client firewall state of quiet clients is dropped
+        constexpr std::chrono::seconds firewall_sweep_interval{10};
+
+        using RequestParser = beast::http::request_parser<RequestBody, RequestAllocator>;
+
+        /// One request of a session's pipeline
+        struct PipelineSlot {
+            std::optional<Response> response;                               // empty if the handler threw
+            std::optional<std::array<asio::const_buffer, 2>> prerendered;  // static route bytes instead
+            bool done = false;
+        };
+
+        /// Counts @p ec against @p counter when it is an expired deadline
+        bool note_timeout(const beast::error_code& ec, std::atomic<std::uint64_t>& counter) noexcept {
+            if (ec != beast::error::timeout) {
+                return false;
+            }
+            counter.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+#if defined(SO_REUSEPORT)
+        constexpr bool reuse_port_supported = true;
+        using reuse_port_option             = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#else
+        constexpr bool reuse_port_supported = false;
+#endif
+
+        /// Pins the thread of shard @p index to one core; false if the platform refused or has no affinity API
+        bool pin_to_core(std::thread& thread, const std::size_t index) {
+#if defined(__linux__)
+            const auto cores = std::max(1u, std::thread::hardware_concurrency());
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(index % cores, &set);
+            return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+            gears::unused_value(thread, index);
+            return false;
+#endif
+        }
+    }  // namespace
+
+    Server::Server(const std::size_t threads, const ServerMode mode)
+        : ioc_(mode == ServerMode::Sharded && reuse_port_supported ? 1 : static_cast<int>(threads)),
           thread_count_(threads) {
-        COMPONENT_LOG_INF() << "Server was created with " << thread_count_ << " threads";
+        if (mode == ServerMode::Sharded) {
+            if constexpr (reuse_port_supported) {
+                // Each shard is touched by its own thread only (stop() goes through the locked scheduler),
+                // so the reactor can skip its per-descriptor locking
+                shards_.reserve(threads);
+                for (std::size_t i = 0; i < threads; ++i) {
+                    shards_.push_back(std::make_unique<asio::io_context>(BOOST_ASIO_CONCURRENCY_HINT_UNSAFE_IO));
+                }
+            } else {
+                COMPONENT_LOG_WRN() << "SO_REUSEPORT is not available, falling back to shared mode";
+            }
+        }
+        COMPONENT_LOG_INF() << "Server was created with " << thread_count_ << " threads"
+                            << (shards_.empty() ? "" : " (sharded)");
     }
 
     Server::~Server() {
@@ -78,32 +158,111 @@ namespace demiplane::http {
     }
 
 
+    void Server::set_timeouts(const timeouts& to) {
+        timeouts_ = to;
+    }
+
+    TimeoutStats Server::timeout_stats() const noexcept {
+        return TimeoutStats{
+            .handshake = handshake_timeouts_.load(std::memory_order_relaxed),
+            .header    = header_timeouts_.load(std::memory_order_relaxed),
+            .body      = body_timeouts_.load(std::memory_order_relaxed),
+            .idle      = idle_timeouts_.load(std::memory_order_relaxed),
+        };
+    }
+
+    void Server::set_pipeline_depth(const std::size_t depth) {
+        pipeline_depth_ = std::max<std::size_t>(depth, 1);
+    }
+
+    void Server::add_static_route(std::string path, StaticResponse response) {
+        static_routes_.insert_or_assign(std::move(path), std::move(response));
+    }
+
+    void Server::add_stream_route(const beast::http::verb method, std::string path, StreamHandler handler) {
+        stream_routes_[method].insert_or_assign(std::move(path), std::move(handler));
+    }
+
+    void Server::set_ip_rules(const std::vector<ip_rule>& rules) {
+        firewall_ = rules.empty() ? nullptr : std::make_unique<Firewall>(rules);
+    }
+
     void Server::listen(uint16_t port) {
         COMPONENT_LOG_INF() << "Server started listening on port " << port;
         running_ = true;
         trigger_start_callbacks();
 
-        asio::co_spawn(
-            ioc_,
-            [this, port]() -> asio::awaitable<void> {
-                const tcp::endpoint ep{tcp::v4(), port};
-                tcp::acceptor acceptor(co_await asio::this_coro::executor, ep);
+        if (firewall_) {
+            asio::co_spawn(ioc_, expire_firewall_state(), asio::detached);
+        }
+        if (shards_.empty()) {
+            asio::co_spawn(ioc_, accept_loop(port, false), asio::detached);
+            return;
+        }
+        for (const auto& shard : shards_) {
+            asio::co_spawn(*shard, accept_loop(port, true), asio::detached);
+        }
+    }
+
+    asio::awaitable<void> Server::accept_loop(const uint16_t port, const bool reuse_port) {
+        const auto executor = co_await asio::this_coro::executor;
+        const tcp::endpoint ep{tcp::v4(), port};
+
+        tcp::acceptor acceptor{executor};
+        acceptor.open(ep.protocol());
+        acceptor.set_option(tcp::acceptor::reuse_address(true));
+        if constexpr (reuse_port_supported) {
+            if (reuse_port) {
+                // Every shard binds the same port; the kernel spreads incoming connections among them
+                acceptor.set_option(reuse_port_option{true});
+            }
+        }
+        acceptor.bind(ep);
+        acceptor.listen();
 
-                while (running_) {
-                    beast::error_code ec;
-                    tcp::socket sock = co_await acceptor.async_accept(asio::redirect_error(asio::use_awaitable, ec));
+        while (running_) {
+            beast::error_code ec;
+            tcp::socket sock = co_await acceptor.async_accept(asio::redirect_error(asio::use_awaitable, ec));
 
-                    if (ec) {
-                        if (ec == asio::error::operation_aborted) {
-                            break;
-                        }
-                        continue;
-                    }
+            if (ec) {
+                if (ec == asio::error::operation_aborted) {
+                    break;
+                }
+                continue;
+            }
 
-                    asio::co_spawn(co_await asio::this_coro::executor, session(std::move(sock)), asio::detached);
+            // Refused clients are shed here, before a session and its arena exist
+            std::optional<Firewall::Lease> admission{std::in_place};
+            if (firewall_) {
+                const auto remote = sock.remote_endpoint(ec);
+                admission         = ec ? std::nullopt : firewall_->admit(remote.address());
+                if (!admission) {
+                    auto x = sock.close(ec);
+                    gears::unused_value(x);
+                    continue;
                 }
-            },
-            asio::detached);
+            }
+
+            // Sessions stay on the acceptor's executor, i.e. on the shard that accepted them. Pipelined
+            // handlers run beside their session, so on a shared multi-threaded context they get a strand.
+            // The lease lives in the session's frame and frees the client's slot when the session ends.
+            const asio::any_io_executor session_executor =
+                pipeline_depth_ > 1 && shards_.empty() ? asio::any_io_executor{asio::make_strand(executor)} : executor;
+            asio::co_spawn(session_executor, session(std::move(sock), std::move(*admission)), asio::detached);
+        }
+    }
+
+    asio::awaitable<void> Server::expire_firewall_state() {
+        asio::steady_timer timer{co_await asio::this_coro::executor};
+        while (running_) {
+            beast::error_code ec;
+            timer.expires_after(firewall_sweep_interval);
+            co_await timer.async_wait(asio::redirect_error(asio::use_awaitable, ec));
+            if (ec) {
+                break;
+            }
+            firewall_->expire();
+        }
     }
 
     void Server::run() {
@@ -111,8 +270,17 @@ namespace demiplane::http {
         signals.async_wait([this](auto, auto) { stop(); });
 
         std::vector<std::thread> threads;
-        for (std::size_t i = 1; i < thread_count_; ++i) {
-            threads.emplace_back([this] { ioc_.run(); });
+        if (shards_.empty()) {
+            for (std::size_t i = 1; i < thread_count_; ++i) {
+                threads.emplace_back([this] { ioc_.run(); });
+            }
+        } else {
+            for (std::size_t i = 0; i < shards_.size(); ++i) {
+                auto& thread = threads.emplace_back([shard = shards_[i].get()] { shard->run(); });
+                if (!pin_to_core(thread, i)) {
+                    COMPONENT_LOG_WRN() << "Failed to pin shard " << i << " to a core";
+                }
+            }
         }
         COMPONENT_LOG_INF() << "Server started";
         ioc_.run();
@@ -133,34 +301,289 @@ namespace demiplane::http {
         COMPONENT_LOG_DBG() << "Server stop initiated";
         running_ = false;
         ioc_.stop();
+        for (const auto& shard : shards_) {
+            shard->stop();
+        }
     }
 
-    asio::awaitable<void> Server::session(tcp::socket socket) const {
+    asio::awaitable<void> Server::session(tcp::socket socket, Firewall::Lease lease) const {
         beast::tcp_stream stream(std::move(socket));
+        const auto executor = co_await asio::this_coro::executor;
+
+        // Per-connection arena for request fields and bodies. It lives in the coroutine frame and is
+        // rewound whenever the pipeline drains, once everything allocated from it has been destroyed.
+        // Past its inline block it spills to the heap; read-ahead stops at arena_spill_limit, so a
+        // client that keeps pipelining lets the pipeline drain and the arena rewind.
+        std::array<std::byte, connection_arena_size> arena_storage;
+        CountingResource arena_spill;
+        std::pmr::monotonic_buffer_resource arena{arena_storage.data(), arena_storage.size(), &arena_spill};
+        const RequestAllocator alloc{&arena};
+
+        // Responses in request order. Handlers fill their slot and wake the session through
+        // handler_done; std::deque keeps slot references valid while both ends move.
+        std::deque<PipelineSlot> pipeline;
+        std::size_t running = 0;
+        asio::steady_timer handler_done{executor, asio::steady_timer::time_point::max()};
+
+        // The request being read; kept across iterations while its bytes are still on the way
+        std::optional<RequestParser> incoming;
+        beast::flat_buffer buffer;
+
+        auto run_handler = [this, &running, &handler_done](Request request, PipelineSlot& slot) -> AsyncVoid {
+            // Whatever the handler throws, the bookkeeping below runs: the session waits for running to
+            // reach zero before its frame goes. Plain statements, not a destructor, so a frame destroyed
+            // without being resumed (io_context torn down) never touches the session's.
+            try {
+                slot.response = co_await handle_request(std::move(request));
+            } catch (const std::exception& e) {
+                trigger_error_callbacks(e);
+            } catch (...) {
+                trigger_error_callbacks(std::runtime_error{"Handler threw a non-standard exception"});
+            }
+            slot.done = true;
+            --running;
+            handler_done.cancel();
+        };
+
+        // Writes the finished head of the pipeline; false once the connection has to end
+        auto send_front = [&]() -> asio::awaitable<bool> {
+            PipelineSlot slot = std::move(pipeline.front());
+            pipeline.pop_front();
+
+            beast::error_code ec;
+            bool keep_alive = true;
+            stream.expires_after(timeouts_.body);
+            if (slot.prerendered) {
+                co_await asio::async_write(stream, *slot.prerendered, asio::redirect_error(asio::use_awaitable, ec));
+            } else if (slot.response) {
+                keep_alive = slot.response->keep_alive();
+                co_await beast::http::async_write(
+                    stream, *slot.response, asio::redirect_error(asio::use_awaitable, ec));
+            } else {
+                co_return false;  // the handler threw, its error callbacks already ran
+            }
+            if (note_timeout(ec, body_timeouts_)) {
+                co_return false;
+            }
+            if (ec) {
+                throw beast::system_error{ec};
+            }
+            if (pipeline.empty() && !incoming) {
+                arena.release();
+            }
+            co_return keep_alive;
+        };
+
+        // Feeds what is already buffered to the parser, never the socket: the rest of the header, or
+        // the rest of the body once the header is in. False if the bytes run out first (or on @p ec).
+        auto parse_buffered = [&buffer](RequestParser& parser, beast::error_code& ec) {
+            const bool header = !parser.is_header_done();
+            while (buffer.size() != 0 && !parser.is_done()) {
+                buffer.consume(parser.put(buffer.data(), ec));
+                if (ec == beast::http::error::need_more) {
+                    ec = {};
+                    break;
+                }
+                if (ec || (header && parser.is_header_done())) {
+                    break;
+                }
+            }
+            return !ec && (header ? parser.is_header_done() : parser.is_done());
+        };
 
+        // Every phase gets its own deadline, so a client trickling bytes (slowloris) or parking an
+        // idle keep-alive connection loses the socket instead of holding it forever. An expired
+        // deadline closes the socket; the session just counts it and leaves.
         try {
-            bool keep_alive;
-            beast::flat_buffer buffer;
-            do {
-                Request req;
-
+            bool reading       = true;   // false once the connection's last request is in
+            bool first_request = true;
+            bool starved       = false;  // the buffered bytes end inside the next request
+            while (reading || !pipeline.empty()) {
                 beast::error_code ec;
-                co_await beast::http::async_read(stream, buffer, req, asio::redirect_error(asio::use_awaitable, ec));
 
-                if (ec == beast::http::error::end_of_stream) {
-                    break;
+                // Send the head of the pipeline as soon as it is ready
+                if (!pipeline.empty() && pipeline.front().done) {
+                    if (!co_await send_front()) {
+                        break;
+                    }
+                    continue;
                 }
-                if (ec) {
-                    co_return;
+
+                // Read the next request. An idle connection waits for it on the socket, under the phase
+                // deadlines. While handlers run, only bytes the client already pipelined are parsed, so
+                // a partial request never holds back a ready response; the socket is read again once
+                // the pipeline is empty.
+                const bool idle = pipeline.empty();
+                if (idle) {
+                    starved = false;
                 }
+                if (reading && pipeline.size() < pipeline_depth_ &&
+                    (idle || (!starved && buffer.size() != 0 && arena_spill.allocated() < arena_spill_limit))) {
+                    if (!incoming) {
+                        // Wait for the request to start: the handshake deadline on a fresh connection, idle after
+                        if (buffer.size() == 0) {
+                            stream.expires_after(first_request ? timeouts_.handshake : timeouts_.idle);
+                            const auto n = co_await stream.async_read_some(
+                                buffer.prepare(beast::read_size(buffer, read_chunk_limit)),
+                                asio::redirect_error(asio::use_awaitable, ec));
+                            if (ec == asio::error::eof) {
+                                reading = false;
+                                continue;
+                            }
+                            if (ec) {
+                                note_timeout(ec, first_request ? handshake_timeouts_ : idle_timeouts_);
+                                break;
+                            }
+                            buffer.commit(n);
+                        }
+                        first_request = false;
+                        incoming.emplace(std::piecewise_construct, std::make_tuple(alloc), std::make_tuple(alloc));
+                        // No body limit until the header shows whether a stream route takes the body
+                        incoming->body_limit(std::numeric_limits<std::uint64_t>::max());
+                    }
+                    auto& parser = *incoming;
+
+                    if (!parser.is_header_done()) {
+                        if (idle) {
+                            stream.expires_after(timeouts_.header);
+                            co_await beast::http::async_read_header(
+                                stream, buffer, parser, asio::redirect_error(asio::use_awaitable, ec));
+                            if (ec == beast::http::error::end_of_stream) {
+                                reading = false;
+                                continue;
+                            }
+                            if (ec) {
+                                note_timeout(ec, header_timeouts_);
+                                break;
+                            }
+                        } else if (!parse_buffered(parser, ec)) {
+                            if (ec) {
+                                break;
+                            }
+                            starved = true;
+                            continue;
+                        }
+
+                        // Only a stream route may take a body past the limit
+                        if (!find_stream_route(parser.get())) {
+                            parser.body_limit(request_body_limit);
+                            if (parser.content_length().value_or(0) > request_body_limit) {
+                                break;
+                            }
+                        }
+
+                        // Every request of the connection counts against the client's rate. Over it, the
+                        // responses ahead still go out and a 429 ends the connection.
+                        if (!lease.charge()) {
+                            auto refused = ResponseFactory::custom(beast::http::status::too_many_requests,
+                                                                   "Too Many Requests",
+                                                                   "text/plain",
+                                                                   parser.get().version());
+                            refused.keep_alive(false);
+                            auto& slot    = pipeline.emplace_back();
+                            slot.response = std::move(refused);
+                            slot.done     = true;
+                            incoming.reset();
+                            reading = false;
+                            continue;
+                        }
+                    }
+
+                    if (const auto* streamer = find_stream_route(parser.get())) {
+                        // The handler takes the connection over, so everything before it goes out first
+                        bool open = true;
+                        while (open && !pipeline.empty()) {
+                            if (pipeline.front().done) {
+                                open = co_await send_front();
+                            } else {
+                                co_await handler_done.async_wait(asio::redirect_error(asio::use_awaitable, ec));
+                            }
+                        }
+                        if (!open) {
+                            break;
+                        }
+
+                        const auto request_version = parser.get().version();
+
+                        // Same parser state, body now read into the handler's memory and unbounded
+                        bool keep_alive = false;
+                        {
+                            StreamExchange::BodyParser body_parser{std::move(parser)};
+                            body_parser.body_limit(boost::none);
+                            StreamExchange exchange{stream, buffer, body_parser, timeouts_.body};
+                            try {
+                                co_await (*streamer)(exchange);
+                                if (!exchange.started()) {
+                                    co_await exchange.send(
+                                        ResponseFactory::internal_error("Internal Server Error", request_version));
+                                }
+                            } catch (const beast::system_error& e) {
+                                if (note_timeout(e.code(), body_timeouts_)) {
+                                    break;
+                                }
+                                throw;
+                            }
+                            keep_alive = exchange.keep_alive();  // false after a half-sent response
+                        }
+                        incoming.reset();
+                        arena.release();
+                        reading = keep_alive;
+                        continue;
+                    }
 
-                Response res = co_await handle_request(std::move(req));
+                    if (!parser.is_done()) {
+                        if (idle) {
+                            stream.expires_after(timeouts_.body);
+                            co_await beast::http::async_read(
+                                stream, buffer, parser, asio::redirect_error(asio::use_awaitable, ec));
+                            if (ec) {
+                                note_timeout(ec, body_timeouts_);
+                                break;
+                            }
+                        } else if (!parse_buffered(parser, ec)) {
+                            if (ec) {
+                                break;
+                            }
+                            starved = true;
+                            continue;
+                        }
+                    }
 
-                keep_alive = res.keep_alive();
-                co_await beast::http::async_write(stream, res, asio::use_awaitable);
-            } while (keep_alive);
+                    reading         = parser.keep_alive();
+                    Request request = parser.release();
+                    incoming.reset();
+
+                    auto& slot = pipeline.emplace_back();
+                    if (const auto* cached = find_static(request)) {
+                        if (StaticResponse::fits(request)) {
+                            slot.prerendered = cached->answer(request);
+                        } else {
+                            slot.response = cached->to_response(request);
+                        }
+                        slot.done = true;
+                        continue;
+                    }
+                    ++running;
+                    if (pipeline_depth_ == 1) {
+                        co_await run_handler(std::move(request), slot);
+                    } else {
+                        asio::co_spawn(executor, run_handler(std::move(request), slot), asio::detached);
+                    }
+                    continue;
+                }
+
+                co_await handler_done.async_wait(asio::redirect_error(asio::use_awaitable, ec));
+            }
         } catch (const std::exception& e) {
             trigger_error_callbacks(e);
+        } catch (...) {
+            trigger_error_callbacks(std::runtime_error{"Session failed with a non-standard exception"});
+        }
+
+        // Running handlers still write into this frame
+        while (running != 0) {
+            beast::error_code ec;
+            co_await handler_done.async_wait(asio::redirect_error(asio::use_awaitable, ec));
         }
 
         beast::error_code ec;
@@ -170,25 +593,22 @@ namespace demiplane::http {
 
     AsyncResponse Server::handle_request(Request request) const {
         trigger_request_callbacks(request);
-        auto target    = std::string(request.target());
-        auto query_pos = target.find('?');
-        auto path      = query_pos != std::string::npos ? target.substr(0, query_pos) : target;
-        auto query     = query_pos != std::string::npos ? target.substr(query_pos + 1) : "";
-        ContextHandler handler;
-        std::unordered_map<std::string, std::string> path_params;
-        try {
-            auto [fst, snd] = registry_.find_handler(request.method(), path);
-            handler         = std::move(fst);
-            path_params     = std::move(snd);
-        } catch ([[maybe_unused]] std::out_of_range& e) {
-            auto response = ResponseFactory::not_found("404 Not Found", request.version());
+        const auto method  = request.method();
+        const auto version = request.version();
+
+        // Route on views into the context's own target, so the parameters stay valid for the handler
+        RequestContext ctx(std::move(request));
+        const auto path  = ctx.path_only();
+        const auto route = registry_.match(method, path);
+        if (!route) {
+            COMPONENT_LOG_WRN() << "No route found for" << SCROLL_PARAMS(method, path);
+            auto response = ResponseFactory::not_found("404 Not Found", version);
             trigger_response_callbacks(response);
             co_return response;
         }
+        const ContextHandler& handler = *route.handler;
 
-        RequestContext ctx(std::move(request));
-        ctx.set_path_params(std::move(path_params));
-        ctx.set_query_params(parse_query_params(query));
+        ctx.set_path_params(route.params);
 
         if (middlewares_.empty()) {
             auto response = co_await handler(std::move(ctx));
@@ -201,24 +621,28 @@ namespace demiplane::http {
         co_return response_result;
     }
 
-    void Server::merge_controller_routes(HttpController* controller) {
-        controller->transfer_routes_to(registry_);
+    const StaticResponse* Server::find_static(const Request& request) const noexcept {
+        if (static_routes_.empty() ||
+            (request.method() != beast::http::verb::get && request.method() != beast::http::verb::head)) {
+            return nullptr;
+        }
+        const std::string_view target{request.target().data(), request.target().size()};
+        const auto it = static_routes_.find(target.substr(0, target.find('?')));
+        return it != static_routes_.end() ? &it->second : nullptr;
     }
 
-    std::unordered_map<std::string, std::string> Server::parse_query_params(const std::string& query) {
-        std::unordered_map<std::string, std::string> params;
-        std::istringstream iss(query);
-        std::string pair;
-
-        while (std::getline(iss, pair, '&')) {
-            if (const auto eq_pos = pair.find('='); eq_pos != std::string::npos) {
-                auto key    = pair.substr(0, eq_pos);
-                auto value  = pair.substr(eq_pos + 1);
-                params[key] = std::move(value);
-            }
+    const StreamHandler* Server::find_stream_route(const Request& request) const noexcept {
+        const auto routes = stream_routes_.find(request.method());
+        if (routes == stream_routes_.end()) {
+            return nullptr;
         }
+        const std::string_view target{request.target().data(), request.target().size()};
+        const auto it = routes->second.find(target.substr(0, target.find('?')));
+        return it != routes->second.end() ? &it->second : nullptr;
+    }
 
-        return params;
+    void Server::merge_controller_routes(HttpController* controller) {
+        controller->transfer_routes_to(registry_);
     }
 
     // Non-blocking callback triggers
@@ -0,0 +1,105 @@
+#include "static_response.hpp"
+
+#include <format>
+#include <sstream>
+
+namespace demiplane::http {
+    namespace http = boost::beast::http;
+
+    namespace {
+        /// 64-bit FNV-1a; stable across runs, so ETags survive restarts
+        std::uint64_t fnv1a(const std::string_view text) noexcept {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (const char c : text) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        std::string render_head(const Response& response) {
+            std::ostringstream out;
+            out << response.base();
+            return std::move(out).str();
+        }
+
+        std::string_view trim(std::string_view text) noexcept {
+            const auto first = text.find_first_not_of(" \t");
+            if (first == std::string_view::npos) {
+                return {};
+            }
+            text.remove_prefix(first);
+            return text.substr(0, text.find_last_not_of(" \t") + 1);
+        }
+    }  // namespace
+
+    StaticResponse::StaticResponse(const http::status status, std::string body, const std::string_view content_type)
+        : prototype_{status, 11},
+          etag_{std::format("\"{:016x}\"", fnv1a(body))} {
+        prototype_.set(http::field::content_type, content_type);
+        prototype_.set(http::field::server, "demiplane/http");
+        prototype_.set(http::field::etag, etag_);
+        prototype_.body() = std::move(body);
+        prototype_.prepare_payload();
+        head_ = render_head(prototype_);
+
+        Response revalidated{http::status::not_modified, 11};
+        revalidated.set(http::field::server, "demiplane/http");
+        revalidated.set(http::field::etag, etag_);
+        not_modified_head_ = render_head(revalidated);
+    }
+
+    bool StaticResponse::not_modified(std::string_view if_none_match) const noexcept {
+        while (!if_none_match.empty()) {
+            const auto comma = if_none_match.find(',');
+            auto tag         = trim(if_none_match.substr(0, comma));
+            if_none_match    = comma != std::string_view::npos ? if_none_match.substr(comma + 1) : std::string_view{};
+
+            if (tag == "*") {
+                return true;
+            }
+            if (tag.starts_with("W/")) {
+                tag.remove_prefix(2);
+            }
+            if (tag == etag_) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool StaticResponse::fits(const Request& request) noexcept {
+        return request.version() == 11 && request.keep_alive();
+    }
+
+    bool StaticResponse::revalidates(const Request& request) const noexcept {
+        const auto it = request.find(http::field::if_none_match);
+        return it != request.end() && not_modified({it->value().data(), it->value().size()});
+    }
+
+    std::array<boost::asio::const_buffer, 2> StaticResponse::answer(const Request& request) const noexcept {
+        if (revalidates(request)) {
+            return {boost::asio::buffer(not_modified_head_), boost::asio::const_buffer{}};
+        }
+        if (request.method() == http::verb::head) {
+            return {boost::asio::buffer(head_), boost::asio::const_buffer{}};
+        }
+        return {boost::asio::buffer(head_), boost::asio::buffer(prototype_.body())};
+    }
+
+    Response StaticResponse::to_response(const Request& request) const {
+        Response response{prototype_};
+        if (revalidates(request)) {
+            response.result(http::status::not_modified);
+            response.erase(http::field::content_type);
+            response.erase(http::field::content_length);
+            response.body().clear();
+        } else if (request.method() == http::verb::head) {
+            response.body().clear();  // Content-Length still announces the GET body
+        }
+        response.version(request.version());
+        response.keep_alive(request.keep_alive());
+        return response;
+    }
+
+}  // namespace demiplane::http
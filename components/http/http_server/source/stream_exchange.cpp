@@ -0,0 +1,210 @@
+#include "stream_exchange.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/asio/redirect_error.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+
+#include "response_factory.hpp"
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <sys/sendfile.h>
+
+    #include <boost/asio/experimental/awaitable_operators.hpp>
+#endif
+
+namespace demiplane::http {
+    namespace beast = boost::beast;
+    namespace asio  = boost::asio;
+
+    namespace {
+#if defined(__linux__)
+        // Linux moves at most this much per sendfile(2) call
+        constexpr std::uint64_t sendfile_chunk_limit = 0x7ffff000;
+        // Files up to this size go out with the head in buffered writes; sendfile(2) pays off past that
+        constexpr std::uint64_t sendfile_min_size = 16 * 1024;
+#endif
+    }  // namespace
+
+    StreamExchange::StreamExchange(beast::tcp_stream& stream,
+                                   beast::flat_buffer& buffer,
+                                   BodyParser& parser,
+                                   const std::chrono::milliseconds deadline) noexcept
+        : stream_{stream},
+          buffer_{buffer},
+          parser_{parser},
+          deadline_{deadline},
+          chunked_{parser.get().version() >= 11} {
+    }
+
+    asio::awaitable<std::size_t> StreamExchange::read_body(const asio::mutable_buffer into) {
+        if (parser_.is_done() || into.size() == 0) {
+            co_return 0;
+        }
+
+        // buffer_body: the parser stores straight into the caller's memory and stops when it is full
+        auto& body = parser_.get().body();
+        body.data  = into.data();
+        body.size  = into.size();
+
+        beast::error_code ec;
+        stream_.expires_after(deadline_);
+        co_await beast::http::async_read(stream_, buffer_, parser_, asio::redirect_error(asio::use_awaitable, ec));
+        if (ec && ec != beast::http::error::need_buffer) {
+            throw beast::system_error{ec};
+        }
+        co_return into.size() - body.size;
+    }
+
+    AsyncVoid StreamExchange::send(Response response) {
+        expect_no_response();
+        response_keep_alive_ = response.keep_alive();
+        stream_.expires_after(deadline_);
+        co_await beast::http::async_write(stream_, response, asio::use_awaitable);
+        state_ = ResponseState::Complete;
+    }
+
+    AsyncVoid StreamExchange::begin_chunked(const beast::http::status status, const std::string_view content_type) {
+        expect_no_response();
+        beast::http::response<beast::http::empty_body> head{status, request().version()};
+        head.set(beast::http::field::content_type, content_type);
+        if (chunked_) {
+            head.chunked(true);
+        } else {
+            head.keep_alive(false);
+        }
+        co_await write_header(head);
+        state_ = ResponseState::Chunked;
+    }
+
+    AsyncVoid StreamExchange::write_chunk(const asio::const_buffer data) {
+        if (state_ != ResponseState::Chunked) {
+            throw std::logic_error("write_chunk() outside a chunked response");
+        }
+        if (data.size() == 0) {
+            co_return;  // an empty chunk would end the body
+        }
+        stream_.expires_after(deadline_);
+        if (chunked_) {
+            co_await asio::async_write(stream_, beast::http::make_chunk(data), asio::use_awaitable);
+        } else {
+            co_await asio::async_write(stream_, data, asio::use_awaitable);
+        }
+    }
+
+    AsyncVoid StreamExchange::end_chunked() {
+        if (state_ != ResponseState::Chunked) {
+            throw std::logic_error("end_chunked() outside a chunked response");
+        }
+        if (chunked_) {
+            stream_.expires_after(deadline_);
+            co_await asio::async_write(stream_, beast::http::make_chunk_last(), asio::use_awaitable);
+        }
+        state_ = ResponseState::Complete;
+    }
+
+    AsyncVoid StreamExchange::send_file(const std::string& path, const std::string_view content_type) {
+        expect_no_response();
+
+        beast::error_code ec;
+        beast::http::file_body::value_type file;
+        file.open(path.c_str(), beast::file_mode::scan, ec);
+        if (ec) {
+            auto missing = ResponseFactory::not_found("Not Found", request().version());
+            missing.keep_alive(parser_.get().keep_alive());
+            co_await send(std::move(missing));
+            co_return;
+        }
+
+#if defined(__linux__)
+        if (file.size() > sendfile_min_size) {
+            // Beast writes the head, the kernel copies the file to the socket without passing through user space
+            beast::http::response<beast::http::empty_body> head{beast::http::status::ok, request().version()};
+            head.set(beast::http::field::content_type, content_type);
+            head.content_length(file.size());
+            co_await write_header(head);
+            co_await sendfile_body(file);
+            state_ = ResponseState::Complete;
+            co_return;
+        }
+#endif
+        // Small files, and any file where sendfile(2) is not available
+        beast::http::response<beast::http::file_body> response{beast::http::status::ok, request().version()};
+        response.set(beast::http::field::content_type, content_type);
+        response.set(beast::http::field::server, "demiplane/http");
+        response.keep_alive(parser_.get().keep_alive());
+        response.body() = std::move(file);
+        response.prepare_payload();
+        response_keep_alive_ = response.keep_alive();
+        stream_.expires_after(deadline_);
+        co_await beast::http::async_write(stream_, response, asio::use_awaitable);
+        state_ = ResponseState::Complete;
+    }
+
+    bool StreamExchange::keep_alive() const noexcept {
+        return state_ == ResponseState::Complete && response_keep_alive_ && parser_.is_done() &&
+               parser_.get().keep_alive();
+    }
+
+    void StreamExchange::expect_no_response() const {
+        if (state_ != ResponseState::None) {
+            throw std::logic_error("Response already started");
+        }
+    }
+
+    AsyncVoid StreamExchange::write_header(beast::http::response<beast::http::empty_body>& head) {
+        head.set(beast::http::field::server, "demiplane/http");
+        if (head.keep_alive()) {
+            head.keep_alive(parser_.get().keep_alive());
+        }
+        response_keep_alive_ = head.keep_alive();
+
+        beast::http::response_serializer<beast::http::empty_body> serializer{head};
+        stream_.expires_after(deadline_);
+        co_await beast::http::async_write_header(stream_, serializer, asio::use_awaitable);
+    }
+
+#if defined(__linux__)
+    AsyncVoid StreamExchange::sendfile_body(beast::http::file_body::value_type& file) {
+        using namespace asio::experimental::awaitable_operators;
+
+        auto& socket         = stream_.socket();
+        const int in         = file.file().native_handle();
+        off_t offset         = 0;
+        std::uint64_t remain = file.size();
+        socket.native_non_blocking(true);
+
+        while (remain != 0) {
+            const auto count = static_cast<std::size_t>(std::min(remain, sendfile_chunk_limit));
+            const auto sent  = ::sendfile(socket.native_handle(), in, &offset, count);
+            if (sent > 0) {
+                remain -= static_cast<std::uint64_t>(sent);
+                continue;
+            }
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                throw beast::system_error{beast::error_code{errno, boost::system::system_category()}};
+            }
+            if (sent == 0) {
+                throw beast::system_error{beast::error_code{EIO, boost::system::system_category()}};  // file shrank
+            }
+
+            // Socket buffer full: wait for room, but no longer than a write through the stream would
+            asio::steady_timer deadline{co_await asio::this_coro::executor, deadline_};
+            const auto ready = co_await (socket.async_wait(asio::socket_base::wait_write, asio::use_awaitable) ||
+                                         deadline.async_wait(asio::use_awaitable));
+            if (ready.index() != 0) {
+                stream_.close();
+                throw beast::system_error{beast::error::timeout};
+            }
+        }
+    }
+#endif
+
+}  // namespace demiplane::http
@@ -0,0 +1,103 @@
+#include <demiplane/chrono>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::chrono;
+using namespace std::chrono_literals;
+
+namespace {
+    Clock::sys_tp utc(const std::chrono::year_month_day ymd,
+                      const std::chrono::hours h,
+                      const std::chrono::minutes m,
+                      const std::chrono::seconds s,
+                      const std::chrono::milliseconds ms) {
+        return std::chrono::sys_days{ymd} + h + m + s + ms;
+    }
+}  // namespace
+
+TEST(ClockTest, IsoMsFormatsUtc) {
+    const auto tp = utc(std::chrono::year{2024} / 2 / 29, 23h, 5min, 9s, 7ms);
+    EXPECT_EQ(UTCClock::format_time_iso_ms(tp), "2024-02-29T23:05:09.007Z");
+}
+
+TEST(ClockTest, IsoMsReusesCachedSecondOnlyWithinTheSameSecond) {
+    const auto base = utc(std::chrono::year{2025} / 12 / 31, 23h, 59min, 59s, 0ms);
+
+    std::string out;
+    UTCClock::append_iso_ms(base + 1ms, out);
+    UTCClock::append_iso_ms(base + 999ms, out);
+    UTCClock::append_iso_ms(base + 1000ms, out);  // rolls minute, hour, day, month and year
+    UTCClock::append_iso_ms(base + 5ms, out);     // back to an earlier second
+
+    EXPECT_EQ(out,
+              "2025-12-31T23:59:59.001Z"
+              "2025-12-31T23:59:59.999Z"
+              "2026-01-01T00:00:00.000Z"
+              "2025-12-31T23:59:59.005Z");
+}
+
+TEST(ClockTest, IsoMsAppendsWithoutClearing) {
+    std::string out = "> ";
+    UTCClock::format_time_iso_ms(utc(std::chrono::year{1999} / 1 / 2, 3h, 4min, 5s, 678ms), out);
+    EXPECT_EQ(out, "> 1999-01-02T03:04:05.678Z");
+    EXPECT_EQ(out.size(), 2 + UTCClock::iso_ms_length);
+}
+
+TEST(ClockTest, IsoMsLocalHasTrailingSpace) {
+    const std::string text = LocalClock::format_time_iso_ms(Clock::now());
+    ASSERT_EQ(text.size(), LocalClock::iso_ms_length);
+    EXPECT_EQ(text[10], 'T');
+    EXPECT_EQ(text[19], '.');
+    EXPECT_EQ(text.back(), ' ');
+}
+
+TEST(TscClockTest, TicksAreMonotonicOnOneThread) {
+    std::uint64_t previous = TscClock::ticks();
+    for (int i = 0; i < 1000; ++i) {
+        const std::uint64_t current = TscClock::ticks();
+        ASSERT_GE(current, previous);
+        previous = current;
+    }
+}
+
+TEST(TscClockTest, CalibrationTracksWallClock) {
+    if (!TscClock::is_invariant()) {
+        GTEST_SKIP() << "no invariant TSC";
+    }
+    auto calibration = TscCalibration::measure(std::chrono::milliseconds{20});
+    EXPECT_GT(calibration.ns_per_tick(), 0.0);
+
+    const auto wall    = std::chrono::system_clock::now();
+    const auto derived = calibration.to_sys(TscClock::ticks());
+    EXPECT_LT(std::chrono::abs(derived - wall), std::chrono::milliseconds{5});
+
+    // A fresh calibration is not due for a refresh yet
+    EXPECT_FALSE(calibration.refresh(std::chrono::seconds{60}));
+    EXPECT_TRUE(calibration.refresh(std::chrono::nanoseconds{0}));
+    EXPECT_LT(std::chrono::abs(calibration.to_sys(TscClock::ticks()) - std::chrono::system_clock::now()),
+              std::chrono::milliseconds{5});
+}
+
+TEST(TscClockTest, NowIsSteadyWithOrWithoutInvariantTsc) {
+    static_assert(TscClock::is_steady);
+
+    // Calibrated ticks on an invariant TSC, steady_clock otherwise — never backwards either way
+    auto previous = TscClock::now();
+    for (int i = 0; i < 1000; ++i) {
+        const auto current = TscClock::now();
+        ASSERT_GE(current, previous);
+        previous = current;
+    }
+}
+
+TEST(TscClockTest, WorksAsStopwatchClock) {
+    TscStopwatch<std::chrono::milliseconds> stopwatch;
+    stopwatch.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds{30});
+    stopwatch.add_flag();
+
+    EXPECT_GE(stopwatch.total_time(), std::chrono::milliseconds{25});
+    EXPECT_LT(stopwatch.total_time(), std::chrono::milliseconds{500});
+}
@@ -617,6 +617,33 @@ TEST_F(DynamicDisruptorTest, DynamicStaticRingBufferIndexWrapping) {
     EXPECT_EQ(buffer[99], 99);  // seq 99 % 8 = 3
 }
 
+TEST_F(DynamicDisruptorTest, DynamicRingBufferContiguousSplitsAtWrap) {
+    DynamicRingBuffer<int> buffer{8};
+    for (std::int64_t seq = 0; seq < 8; ++seq) {
+        buffer[seq] = static_cast<int>(seq);
+    }
+
+    // No wrap: the whole run in one view
+    const auto whole = buffer.contiguous(2, 5);
+    ASSERT_EQ(whole.size(), 4u);
+    EXPECT_EQ(whole.front(), 2);
+    EXPECT_EQ(whole.back(), 5);
+
+    // Run 14..17 maps to slots 6, 7, 0, 1 — cut at the physical end, rest from slot 0
+    const auto head = buffer.contiguous(14, 17);
+    ASSERT_EQ(head.size(), 2u);
+    EXPECT_EQ(head.front(), 6);
+    EXPECT_EQ(head.data(), &buffer[14]);
+
+    const auto tail = buffer.contiguous(14 + static_cast<std::int64_t>(head.size()), 17);
+    ASSERT_EQ(tail.size(), 2u);
+    EXPECT_EQ(tail.front(), 0);
+    EXPECT_EQ(tail.back(), 1);
+
+    // Nothing left past the end of the run
+    EXPECT_TRUE(buffer.contiguous(18, 17).empty());
+}
+
 TEST_F(DynamicDisruptorTest, DynamicDisruptorSingleClaim) {
     DynamicDisruptor<int> disruptor{1024, std::make_unique<YieldingWaitStrategy>()};
 
@@ -703,6 +730,38 @@ TEST_F(DynamicDisruptorTest, DynamicDisruptorBackpressure) {
     EXPECT_EQ(claimed_seq.load(), 8);  // Successfully claimed next sequence
 }
 
+TEST_F(DynamicDisruptorTest, DynamicDisruptorAdvanceGatingNeverMovesBackward) {
+    DynamicDisruptor<int> disruptor{8, std::make_unique<YieldingWaitStrategy>()};
+
+    disruptor.sequencer().advance_gating_sequence(5);
+    EXPECT_EQ(disruptor.sequencer().get_gating_sequence(), 5);
+
+    // A late release of an older run must not hand slots back
+    disruptor.sequencer().advance_gating_sequence(3);
+    EXPECT_EQ(disruptor.sequencer().get_gating_sequence(), 5);
+
+    disruptor.sequencer().advance_gating_sequence(9);
+    EXPECT_EQ(disruptor.sequencer().get_gating_sequence(), 9);
+}
+
+TEST_F(DynamicDisruptorTest, DynamicDisruptorAdvanceGatingConcurrentKeepsMaximum) {
+    DynamicDisruptor<int> disruptor{1024, std::make_unique<YieldingWaitStrategy>()};
+
+    std::vector<std::thread> releasers;
+    for (int t = 0; t < 4; ++t) {
+        releasers.emplace_back([&, t] {
+            for (std::int64_t seq = t; seq < 4000; seq += 4) {
+                disruptor.sequencer().advance_gating_sequence(seq);
+            }
+        });
+    }
+    for (auto& releaser : releasers) {
+        releaser.join();
+    }
+
+    EXPECT_EQ(disruptor.sequencer().get_gating_sequence(), 3999);
+}
+
 TEST_F(DynamicDisruptorTest, DynamicDisruptorMultiThreadedOrdering) {
     const size_t BUFFER_SIZE       = 1024;
     const int NUM_PRODUCERS        = 4;
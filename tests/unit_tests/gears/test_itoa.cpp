@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <limits>
+#include <string>
+
+#include <gears_itoa.hpp>
+#include <gtest/gtest.h>
+
+using namespace demiplane::gears;
+
+namespace {
+    std::string reference(const std::uint64_t value) {
+        char buffer[32];
+        const int len = std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+        return {buffer, static_cast<std::size_t>(len)};
+    }
+
+    std::string written(const std::uint64_t value) {
+        char buffer[max_decimal_digits];
+        return {buffer, write_decimal(buffer, value)};
+    }
+}  // namespace
+
+TEST(ItoaTest, DecimalDigitsAtEveryPowerOfTen) {
+    EXPECT_EQ(decimal_digits(0), 1u);
+    std::uint64_t power = 1;
+    for (std::size_t digits = 1; digits <= max_decimal_digits; ++digits) {
+        EXPECT_EQ(decimal_digits(power), digits) << power;
+        if (power > 1) {
+            EXPECT_EQ(decimal_digits(power - 1), digits - 1) << power - 1;
+        }
+        if (digits < max_decimal_digits) {
+            power *= 10;
+        }
+    }
+    EXPECT_EQ(decimal_digits(std::numeric_limits<std::uint64_t>::max()), max_decimal_digits);
+}
+
+TEST(ItoaTest, WriteDecimalMatchesPrintf) {
+    for (std::uint64_t value = 0; value < 100'000; ++value) {
+        ASSERT_EQ(written(value), reference(value));
+    }
+    std::uint64_t power = 10;
+    for (std::size_t i = 1; i < max_decimal_digits; ++i, power *= 10) {
+        EXPECT_EQ(written(power - 1), reference(power - 1));
+        EXPECT_EQ(written(power), reference(power));
+        EXPECT_EQ(written(power + 1), reference(power + 1));
+    }
+    EXPECT_EQ(written(std::numeric_limits<std::uint64_t>::max()), "18446744073709551615");
+}
+
+TEST(ItoaTest, Write2DigitsZeroPads) {
+    char buffer[2];
+    write_2digits(buffer, 7);
+    EXPECT_EQ(std::string_view(buffer, 2), "07");
+    write_2digits(buffer, 42);
+    EXPECT_EQ(std::string_view(buffer, 2), "42");
+}
+
+TEST(ItoaTest, AppendDecimalAppends) {
+    std::string out = "line:";
+    append_decimal(out, 1234);
+    EXPECT_EQ(out, "line:1234");
+}
+
+TEST(ItoaTest, UsableInConstantExpressions) {
+    static_assert(decimal_digits(999) == 3);
+    static_assert(decimal_digits(1000) == 4);
+    SUCCEED();
+}
@@ -0,0 +1,44 @@
+#include <query_params.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::http;
+
+TEST(QueryParamsTest, PlainPairsViewIntoInput) {
+    const std::string_view query = "limit=5&sort=asc&debug&&empty=";
+    const auto params            = QueryParams::parse(query);
+
+    ASSERT_EQ(params.size(), 4u);
+    EXPECT_EQ(params.get("limit"), "5");
+    EXPECT_EQ(params.get("sort"), "asc");
+    EXPECT_EQ(params.get("debug"), "");
+    EXPECT_EQ(params.get("empty"), "");
+    EXPECT_FALSE(params.get("missing"));
+    EXPECT_EQ(params.get("sort")->data(), query.data() + 13);
+}
+
+TEST(QueryParamsTest, DecodesEscapesOnlyWhereNeeded) {
+    const std::string_view query = "q=caf%C3%A9+au+lait&page=2&na%6De=x%2fy";
+    const auto params            = QueryParams::parse(query);
+
+    EXPECT_EQ(params.get("q"), "caf\xC3\xA9 au lait");
+    EXPECT_EQ(params.get("name"), "x/y");
+    EXPECT_EQ(params.get("page")->data(), query.data() + 25);
+}
+
+TEST(QueryParamsTest, KeepsMalformedEscapesLiterally) {
+    const auto params = QueryParams::parse("a=100%&b=%zz&c=%4");
+
+    EXPECT_EQ(params.get("a"), "100%");
+    EXPECT_EQ(params.get("b"), "%zz");
+    EXPECT_EQ(params.get("c"), "%4");
+}
+
+TEST(QueryParamsTest, CopyOwnsDecodedValues) {
+    auto original = std::make_unique<QueryParams>(QueryParams::parse("q=a%20b&n=1"));
+    const QueryParams copy{*original};
+    original.reset();
+
+    EXPECT_EQ(copy.get("q"), "a b");
+    EXPECT_EQ(copy.get("n"), "1");
+}
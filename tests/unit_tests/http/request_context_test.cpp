@@ -0,0 +1,126 @@
+#include <array>
+#include <memory_resource>
+#include <request_context.hpp>
+#include <route_registry.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::http;
+using boost::beast::http::verb;
+
+namespace {
+    AsyncResponse noop_handler(RequestContext /*ctx*/) {
+        co_return Response{};
+    }
+
+    /// Routes the context the way Server::handle_request does
+    void route(RequestContext& ctx, const RouteRegistry& registry) {
+        const auto match = registry.match(verb::get, ctx.path_only());
+        ASSERT_TRUE(match);
+        ctx.set_path_params(match.params);
+    }
+
+    Request make_request(const std::string_view target) {
+        Request req{verb::get, target, 11};
+        req.set(boost::beast::http::field::content_type, "application/json");
+        req.set("X-Request-Id", "abc-123");
+        return req;
+    }
+}  // namespace
+
+class RequestContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        registry.add_route(verb::get, "/orders/{order_id}/items/{item}", noop_handler);
+    }
+
+    RouteRegistry registry;
+};
+
+TEST_F(RequestContextTest, HeadersAreCaseInsensitive) {
+    const RequestContext ctx{make_request("/orders/1/items/2")};
+
+    EXPECT_EQ(ctx.header("x-request-id"), "abc-123");
+    EXPECT_EQ(ctx.header("X-REQUEST-ID"), "abc-123");
+    EXPECT_EQ(ctx.header_or("accept", "*/*"), "*/*");
+    EXPECT_FALSE(ctx.header("accept"));
+    EXPECT_TRUE(ctx.is_json());
+}
+
+TEST_F(RequestContextTest, TargetIsSplitWithoutCopies) {
+    const RequestContext ctx{make_request("/orders/1/items/2?limit=5&sort=asc")};
+
+    EXPECT_EQ(ctx.path_only(), "/orders/1/items/2");
+    EXPECT_EQ(ctx.query_string(), "limit=5&sort=asc");
+    EXPECT_EQ(ctx.path_only().data(), ctx.target().data());
+}
+
+TEST_F(RequestContextTest, ParamsViewIntoTarget) {
+    RequestContext ctx{make_request("/orders/17/items/widget?limit=5")};
+    route(ctx, registry);
+
+    EXPECT_EQ(ctx.path<int>("order_id"), 17);
+    EXPECT_EQ(ctx.path<std::string_view>("item"), "widget");
+    EXPECT_EQ(ctx.path_or<std::string>("missing", "none"), "none");
+    EXPECT_EQ(ctx.query<int>("limit"), 5);
+    EXPECT_FALSE(ctx.query<int>("offset"));
+
+    const auto item = ctx.path<std::string_view>("item");
+    ASSERT_TRUE(item);
+    EXPECT_EQ(item->data(), ctx.target().data() + 17);
+}
+
+TEST_F(RequestContextTest, MoveAndCopyKeepParamsValid) {
+    RequestContext original{make_request("/orders/17/items/widget?limit=5&q=a%20b")};
+    route(original, registry);
+    ASSERT_EQ(original.query_params().size(), 2u);
+
+    const RequestContext moved{std::move(original)};
+    EXPECT_EQ(moved.path<std::string_view>("item"), "widget");
+
+    const auto copy = std::make_unique<RequestContext>(moved);
+    const auto item = copy->path<std::string_view>("item");
+    ASSERT_TRUE(item);
+    EXPECT_EQ(*item, "widget");
+    EXPECT_EQ(item->data(), copy->target().data() + 17);
+    EXPECT_EQ(copy->query<int>("limit"), 5);
+    EXPECT_EQ(copy->query<std::string_view>("q"), "a b");
+    EXPECT_EQ(copy->query_params().get("limit")->data(), copy->target().data() + 30);
+}
+
+TEST_F(RequestContextTest, NumbersParseFromWholeValue) {
+    const RequestContext ctx{make_request("/orders?limit=12abc&offset=-3&ratio=0.25&empty=")};
+
+    EXPECT_FALSE(ctx.query<int>("limit"));
+    EXPECT_EQ(ctx.query<long>("offset"), -3);
+    EXPECT_EQ(ctx.query<double>("ratio"), 0.25);
+    EXPECT_FALSE(ctx.query<int>("empty"));
+    EXPECT_EQ(ctx.query_or<int>("missing", 10), 10);
+}
+
+TEST_F(RequestContextTest, CopyOutlivesConnectionArena) {
+    std::unique_ptr<RequestContext> kept;
+    {
+        std::array<std::byte, 4096> storage;
+        // null upstream: anything that does not fit the arena would throw
+        std::pmr::monotonic_buffer_resource arena{storage.data(), storage.size(), std::pmr::null_memory_resource()};
+        const RequestAllocator alloc{&arena};
+
+        Request req{std::piecewise_construct, std::make_tuple(alloc), std::make_tuple(alloc)};
+        req.method(verb::get);
+        req.target("/orders/17/items/widget?q=a%20b");
+        req.set("X-Request-Id", "abc-123");
+        req.body() = "payload";
+
+        RequestContext ctx{std::move(req)};
+        route(ctx, registry);
+        ASSERT_EQ(ctx.query_params().size(), 1u);
+
+        kept = std::make_unique<RequestContext>(ctx);
+    }  // ctx, then the arena and its storage are gone
+
+    EXPECT_EQ(kept->path<std::string_view>("item"), "widget");
+    EXPECT_EQ(kept->query<std::string_view>("q"), "a b");
+    EXPECT_EQ(kept->header("x-request-id"), "abc-123");
+    EXPECT_EQ(kept->body(), "payload");
+}
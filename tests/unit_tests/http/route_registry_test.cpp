@@ -0,0 +1,125 @@
+#include <request_context.hpp>
+#include <route_registry.hpp>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::http;
+using boost::beast::http::verb;
+
+namespace {
+    /// Handler that only carries an id, so tests can tell which route matched
+    struct TaggedHandler {
+        int id;
+
+        AsyncResponse operator()(RequestContext /*ctx*/) const {
+            co_return Response{};
+        }
+    };
+
+    int matched_id(const RouteMatch& match) {
+        if (!match) {
+            return -1;
+        }
+        const auto* tagged = match.handler->target<TaggedHandler>();
+        return tagged ? tagged->id : -1;
+    }
+}  // namespace
+
+class RouteRegistryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        registry.add_route(verb::get, "/users", TaggedHandler{1});
+        registry.add_route(verb::get, "/users/{id}", TaggedHandler{2});
+        registry.add_route(verb::get, "/users/me", TaggedHandler{3});
+        registry.add_route(verb::get, "/users/{id}/posts/{post_id}", TaggedHandler{4});
+        registry.add_route(verb::get, "/users/me/settings", TaggedHandler{5});
+        registry.add_route(verb::post, "/users", TaggedHandler{6});
+        registry.add_route(verb::get, "/user-groups", TaggedHandler{7});
+    }
+
+    RouteRegistry registry;
+};
+
+TEST_F(RouteRegistryTest, MatchesStaticRoutesPerMethod) {
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/users")), 1);
+    EXPECT_EQ(matched_id(registry.match(verb::post, "/users")), 6);
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/user-groups")), 7);
+    EXPECT_FALSE(registry.match(verb::delete_, "/users"));
+    EXPECT_FALSE(registry.match(verb::get, "/user"));
+    EXPECT_FALSE(registry.match(verb::get, "/users/"));
+}
+
+TEST_F(RouteRegistryTest, ExtractsParametersAsViewsIntoPath) {
+    const std::string path = "/users/42/posts/7";
+    const auto match       = registry.match(verb::get, path);
+
+    ASSERT_EQ(matched_id(match), 4);
+    ASSERT_EQ(match.params.size(), 2u);
+    EXPECT_EQ(match.params.get("id"), "42");
+    EXPECT_EQ(match.params.get("post_id"), "7");
+    EXPECT_FALSE(match.params.get("missing"));
+    EXPECT_EQ(match.params.get("id")->data(), path.data() + 7);
+}
+
+TEST_F(RouteRegistryTest, StaticSegmentWinsAndBacktracksToParameter) {
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/users/me")), 3);
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/users/me/settings")), 5);
+
+    // "me" is a static edge, but only the parameter route continues with /posts/...
+    const auto match = registry.match(verb::get, "/users/me/posts/1");
+    EXPECT_EQ(matched_id(match), 4);
+    EXPECT_EQ(match.params.get("id"), "me");
+
+    // Shares the "me" prefix but is a different segment
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/users/mean")), 2);
+}
+
+TEST_F(RouteRegistryTest, ReplacesIdenticalRoute) {
+    registry.add_route(verb::get, "/users/{id}", TaggedHandler{8});
+
+    EXPECT_EQ(registry.route_count(), 7u);
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/users/42")), 8);
+}
+
+TEST_F(RouteRegistryTest, RejectsMalformedPatterns) {
+    EXPECT_THROW(registry.add_route(verb::get, "/users/{user_id}/avatar", TaggedHandler{0}), std::invalid_argument);
+    EXPECT_THROW(registry.add_route(verb::get, "/files/{name}.json", TaggedHandler{0}), std::invalid_argument);
+    EXPECT_THROW(registry.add_route(verb::get, "/files/{}", TaggedHandler{0}), std::invalid_argument);
+    EXPECT_THROW(registry.add_route(verb::get, "/files/{name", TaggedHandler{0}), std::invalid_argument);
+}
+
+TEST_F(RouteRegistryTest, RejectedPatternLeavesTreeUntouched) {
+    // Both fail only after their first parameter; neither may leave a {name} node behind
+    std::string too_many = "/many";
+    for (std::size_t i = 0; i <= max_path_params; ++i) {
+        too_many += "/{p" + std::to_string(i) + "}";
+    }
+    EXPECT_THROW(registry.add_route(verb::get, too_many, TaggedHandler{0}), std::invalid_argument);
+    EXPECT_THROW(registry.add_route(verb::get, "/files/{dir}/{name}.json", TaggedHandler{0}), std::invalid_argument);
+    EXPECT_EQ(registry.route_count(), 7u);
+
+    // Other names at the same positions are no conflict
+    registry.add_route(verb::get, "/many/{count}", TaggedHandler{8});
+    registry.add_route(verb::get, "/files/{path}", TaggedHandler{9});
+    const auto match = registry.match(verb::get, "/many/3");
+    EXPECT_EQ(matched_id(match), 8);
+    EXPECT_EQ(match.params.get("count"), "3");
+    EXPECT_EQ(matched_id(registry.match(verb::get, "/files/a.txt")), 9);
+    EXPECT_FALSE(registry.match(verb::get, "/files/a/b.json"));
+}
+
+TEST_F(RouteRegistryTest, CopyAndMergeKeepRoutes) {
+    const RouteRegistry copy{registry};
+    EXPECT_EQ(copy.route_count(), registry.route_count());
+    EXPECT_EQ(matched_id(copy.match(verb::get, "/users/1/posts/2")), 4);
+
+    RouteRegistry target;
+    target.add_route(verb::put, "/users/{id}", TaggedHandler{9});
+    target.merge(std::move(registry));
+
+    EXPECT_EQ(target.route_count(), 8u);
+    EXPECT_EQ(registry.route_count(), 0u);
+    EXPECT_EQ(matched_id(target.match(verb::put, "/users/1")), 9);
+    EXPECT_EQ(matched_id(target.match(verb::get, "/users/me")), 3);
+}
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+#include <response_factory.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <gtest/gtest.h>
+
+#include "server_test_fixture.hpp"
+
+using namespace demiplane::http;
+using namespace std::chrono_literals;
+
+namespace {
+    AsyncVoid sleep_for(const std::chrono::milliseconds duration) {
+        boost::asio::steady_timer timer{co_await boost::asio::this_coro::executor, duration};
+        co_await timer.async_wait(boost::asio::use_awaitable);
+    }
+
+    // /wait?ms= answers with its own name after a delay, /throw and /throw-int fail
+    class PipelineController final : public HttpController {
+    public:
+        void configure_routes() override {
+            Get("/wait", [this](RequestContext ctx) -> AsyncResponse {
+                const auto name = ctx.query_or<std::string>("name", "");
+                const auto now  = in_flight.fetch_add(1) + 1;
+                for (auto seen = max_in_flight.load(); seen < now && !max_in_flight.compare_exchange_weak(seen, now);) {
+                }
+                co_await sleep_for(std::chrono::milliseconds{ctx.query_or<int>("ms", 0)});
+                in_flight.fetch_sub(1);
+                {
+                    const std::lock_guard lock{mutex};
+                    finished.push_back(name);
+                }
+                co_return ResponseFactory::ok(name);
+            });
+            Get("/throw", [](RequestContext) -> AsyncResponse {
+                throw std::runtime_error("handler failed");
+                co_return ResponseFactory::ok();
+            });
+            Get("/throw-int", [](RequestContext) -> AsyncResponse {
+                throw 42;
+                co_return ResponseFactory::ok();
+            });
+        }
+
+        std::atomic<int> in_flight{0};
+        std::atomic<int> max_in_flight{0};
+        std::mutex mutex;
+        std::vector<std::string> finished;
+    };
+
+    std::string get(const std::string& target, const bool close = false) {
+        return "GET " + target + " HTTP/1.1\r\nHost: test\r\n" + (close ? "Connection: close\r\n" : "") + "\r\n";
+    }
+
+    std::size_t count(const std::string& text, const std::string_view needle) {
+        std::size_t n = 0;
+        for (auto at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1)) {
+            ++n;
+        }
+        return n;
+    }
+}  // namespace
+
+class ServerPipelineTest : public demiplane::test::ServerTest {
+protected:
+    void SetUp() override {
+        server.add_controller(controller);
+    }
+
+    std::shared_ptr<PipelineController> controller = std::make_shared<PipelineController>();
+};
+
+TEST_F(ServerPipelineTest, RespondsInRequestOrderWhenLaterHandlerFinishesFirst) {
+    server.set_pipeline_depth(4);
+    start();
+
+    auto client = connect();
+    ASSERT_TRUE(client.send(get("/wait?name=slow&ms=200") + get("/wait?name=fast&ms=0")));
+
+    const auto first  = client.read();
+    const auto second = client.read();
+    ASSERT_TRUE(first && second);
+    EXPECT_EQ(first->body(), "slow");
+    EXPECT_EQ(second->body(), "fast");
+
+    const std::lock_guard lock{controller->mutex};
+    EXPECT_EQ(controller->finished, (std::vector<std::string>{"fast", "slow"}));
+}
+
+TEST_F(ServerPipelineTest, SendsReadyResponseWhileNextRequestIsPartial) {
+    server.set_pipeline_depth(4);
+    start();
+
+    // The second request stays incomplete until the first response is in
+    auto client = connect();
+    ASSERT_TRUE(client.send(get("/wait?name=first&ms=0") + "GET /wait?name=second HT"));
+    const auto first = client.read(1s);
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first->body(), "first");
+
+    ASSERT_TRUE(client.send("TP/1.1\r\nHost: test\r\n\r\n"));
+    const auto second = client.read();
+    ASSERT_TRUE(second);
+    EXPECT_EQ(second->body(), "second");
+}
+
+TEST_F(ServerPipelineTest, DepthLimitsHandlersInFlight) {
+    server.set_pipeline_depth(2);
+    start();
+
+    std::string requests;
+    for (int i = 0; i < 6; ++i) {
+        requests += get("/wait?name=" + std::to_string(i) + "&ms=50", i == 5);
+    }
+    const auto received = connect().exchange(requests);
+    ASSERT_TRUE(received);
+    EXPECT_EQ(count(*received, "HTTP/1.1 200 OK"), 6u);
+    EXPECT_EQ(controller->max_in_flight.load(), 2);
+}
+
+TEST_F(ServerPipelineTest, ThrowingHandlerClosesSession) {
+    std::atomic<int> errors{0};
+    server.on_error([&errors](const std::exception&) { errors.fetch_add(1); });
+    server.set_pipeline_depth(4);
+    start();
+
+    // Whatever the handler throws, the responses before it go out and the connection ends there
+    for (const std::string_view target : {"/throw", "/throw-int"}) {
+        const auto received =
+            connect().exchange(get("/wait?name=before&ms=50") + get(std::string{target}) + get("/wait?name=after"));
+        ASSERT_TRUE(received) << target;
+        EXPECT_EQ(count(*received, "HTTP/1.1 200 OK"), 1u) << target;
+        EXPECT_NE(received->find("before"), std::string::npos) << target;
+        EXPECT_EQ(received->find("after"), std::string::npos) << target;
+    }
+    EXPECT_TRUE(demiplane::test::eventually([&errors] { return errors.load() == 2; }));
+}
+
+TEST_F(ServerPipelineTest, ThrowingHandlerClosesSessionWithoutPipelining) {
+    start();
+
+    const auto received = connect().exchange(get("/throw-int") + get("/wait?name=after"));
+    ASSERT_TRUE(received);
+    EXPECT_EQ(received->find("HTTP/1.1"), std::string::npos);
+}
+
+TEST_F(ServerPipelineTest, ArenaRewindsUnderSustainedPipelining) {
+    // Requests live in the connection arena; its heap spill shows through their allocator
+    std::atomic<std::size_t> max_spill{0};
+    server.on_request([&max_spill](const Request& request) {
+        const auto* arena = dynamic_cast<std::pmr::monotonic_buffer_resource*>(request.get_allocator().resource());
+        ASSERT_NE(arena, nullptr);
+        const auto* spill = dynamic_cast<const CountingResource*>(arena->upstream_resource());
+        ASSERT_NE(spill, nullptr);
+        max_spill.store(std::max(max_spill.load(), spill->allocated()));  // only the session's thread writes
+    });
+    server.set_pipeline_depth(4);
+    start();
+
+    // Several megabytes of requests in one go: far more than the arena may keep between rewinds
+    constexpr int requests = 5000;
+    const std::string padding(512, 'x');
+    std::string stream;
+    for (int i = 0; i < requests; ++i) {
+        stream += "GET /wait?name=r HTTP/1.1\r\nHost: test\r\nX-Padding: " + padding + "\r\n";
+        stream += i + 1 == requests ? "Connection: close\r\n\r\n" : "\r\n";
+    }
+    const auto received = connect().exchange(stream, 30s);
+    ASSERT_TRUE(received);
+    EXPECT_EQ(count(*received, "HTTP/1.1 200 OK"), static_cast<std::size_t>(requests));
+    EXPECT_LT(max_spill.load(), 256u * 1024u);
+}
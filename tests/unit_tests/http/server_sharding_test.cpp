@@ -0,0 +1,68 @@
+#include <deque>
+#include <response_factory.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "server_test_fixture.hpp"
+
+using namespace demiplane::http;
+
+namespace {
+    // Answers with the id of the thread that ran the handler
+    class ThreadController final : public HttpController {
+    public:
+        void configure_routes() override {
+            Get("/thread", [](RequestContext) -> AsyncResponse {
+                std::ostringstream id;
+                id << std::this_thread::get_id();
+                co_return ResponseFactory::ok(id.str());
+            });
+        }
+    };
+}  // namespace
+
+class ServerShardingTest : public demiplane::test::ServerTest {
+protected:
+    ServerShardingTest()
+        : ServerTest{shards, ServerMode::Sharded} {
+    }
+
+    void SetUp() override {
+        server.add_controller(std::make_shared<ThreadController>());
+    }
+
+    static constexpr std::size_t shards = 4;
+};
+
+TEST_F(ServerShardingTest, ServesConnectionsEachOnOneShard) {
+    start();
+
+    // All connections open at once, several keep-alive requests on each
+    constexpr int connections = 16;
+    std::deque<demiplane::test::Client> clients;
+    for (int i = 0; i < connections; ++i) {
+        clients.emplace_back(port);
+    }
+
+    std::set<std::string> threads;
+    for (auto& client : clients) {
+        std::set<std::string> own;
+        for (int request = 0; request < 3; ++request) {
+            ASSERT_TRUE(client.send("GET /thread HTTP/1.1\r\nHost: test\r\n\r\n"));
+            const auto response = client.read();
+            ASSERT_TRUE(response);
+            own.insert(response->body());
+        }
+        EXPECT_EQ(own.size(), 1u);  // a connection never leaves its shard
+        threads.insert(own.begin(), own.end());
+    }
+
+    EXPECT_LE(threads.size(), shards);
+#if defined(SO_REUSEPORT)
+    EXPECT_GT(threads.size(), 1u);  // the kernel spreads the connections
+#endif
+}
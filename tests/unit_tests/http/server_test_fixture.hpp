@@ -0,0 +1,160 @@
+#pragma once
+
+// Shared pieces of the tests that talk to a running Server over loopback
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <server.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <gtest/gtest.h>
+
+namespace demiplane::test {
+    using namespace std::chrono_literals;
+
+    /// Loopback port nothing listens on at the moment
+    inline std::uint16_t free_port() {
+        boost::asio::io_context ioc;
+        const boost::asio::ip::tcp::acceptor probe{ioc, {boost::asio::ip::tcp::v4(), 0}};
+        return probe.local_endpoint().port();
+    }
+
+    /// True once @p condition holds, polled for at most @p wait
+    inline bool eventually(const std::function<bool()>& condition, const std::chrono::milliseconds wait = 2s) {
+        const auto deadline = std::chrono::steady_clock::now() + wait;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(5ms);
+        }
+        return true;
+    }
+
+    /// Blocking HTTP/1.1 client of one connection; every read gives up after its wait
+    class Client {
+    public:
+        explicit Client(const std::uint16_t port) {
+            // The acceptor opens once run() got going, so refused attempts are retried for a while
+            const boost::asio::ip::tcp::endpoint server{boost::asio::ip::make_address("127.0.0.1"), port};
+            for (int attempt = 0; attempt < 200; ++attempt) {
+                boost::system::error_code ec;
+                socket_ = boost::asio::ip::tcp::socket{ioc_};
+                socket_.connect(server, ec);
+                if (!ec) {
+                    return;
+                }
+                std::this_thread::sleep_for(10ms);
+            }
+            ADD_FAILURE() << "Nothing accepted connections on port " << port;
+        }
+
+        /// Writes @p bytes; false once the server has closed the connection
+        bool send(const std::string_view bytes) {
+            boost::system::error_code ec;
+            boost::asio::write(socket_, boost::asio::buffer(bytes), ec);
+            return !ec;
+        }
+
+        /// Next response, or nullopt if the connection ended or nothing complete arrived within @p wait
+        std::optional<http::Response> read(const std::chrono::milliseconds wait = 5s) {
+            http::Response response;
+            boost::system::error_code ec = boost::asio::error::would_block;
+            boost::beast::http::async_read(
+                socket_, buffer_, response, [&ec](const boost::system::error_code& e, std::size_t) { ec = e; });
+            run_for(wait);
+            if (ec) {
+                return std::nullopt;
+            }
+            return response;
+        }
+
+        /// Writes @p bytes while collecting everything the server sends until it closes the connection;
+        /// nullopt if it is still open after @p wait
+        std::optional<std::string> exchange(const std::string_view bytes, const std::chrono::milliseconds wait = 5s) {
+            boost::asio::async_write(
+                socket_, boost::asio::buffer(bytes), [](const boost::system::error_code&, std::size_t) {});
+            return read_to_end(wait);
+        }
+
+        /// Everything the server sends until it closes the connection; nullopt if it is still open after @p wait
+        std::optional<std::string> read_to_end(const std::chrono::milliseconds wait = 5s) {
+            std::string received{static_cast<const char*>(buffer_.data().data()), buffer_.size()};
+            buffer_.consume(buffer_.size());
+
+            bool ended = false;
+            std::array<char, 4096> chunk;
+            std::function<void()> next = [&] {
+                socket_.async_read_some(boost::asio::buffer(chunk),
+                                        [&](const boost::system::error_code& ec, const std::size_t n) {
+                                            received.append(chunk.data(), n);
+                                            if (ec) {
+                                                ended = ec != boost::asio::error::operation_aborted;
+                                                return;
+                                            }
+                                            next();
+                                        });
+            };
+            next();
+            run_for(wait);
+            if (!ended) {
+                return std::nullopt;
+            }
+            return received;
+        }
+
+    private:
+        boost::asio::io_context ioc_;
+        boost::asio::ip::tcp::socket socket_{ioc_};
+        boost::beast::flat_buffer buffer_;
+
+        // Runs the pending operations; whatever is still pending after @p wait is cancelled
+        void run_for(const std::chrono::milliseconds wait) {
+            ioc_.restart();
+            ioc_.run_for(wait);
+            if (!ioc_.stopped()) {
+                socket_.cancel();
+                ioc_.restart();
+                ioc_.run();
+            }
+        }
+    };
+
+    /// Base fixture: configure the server in the test, then start() it; it is stopped after the test
+    class ServerTest : public ::testing::Test {
+    protected:
+        explicit ServerTest(const std::size_t threads = 1, const http::ServerMode mode = http::ServerMode::Shared)
+            : server{threads, mode} {
+        }
+
+        void TearDown() override {
+            if (runner.joinable()) {
+                server.stop();
+                runner.join();
+            }
+        }
+
+        void start() {
+            server.listen(port);
+            runner = std::thread{[this] { server.run(); }};
+        }
+
+        [[nodiscard]] Client connect() const {
+            return Client{port};
+        }
+
+        const std::uint16_t port = free_port();
+        http::Server server;
+        std::thread runner;
+    };
+
+}  // namespace demiplane::test
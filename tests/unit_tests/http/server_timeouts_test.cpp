@@ -0,0 +1,98 @@
+#include <chrono>
+#include <response_factory.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "server_test_fixture.hpp"
+
+using namespace demiplane::http;
+using namespace std::chrono_literals;
+
+namespace {
+    class EchoController final : public HttpController {
+    public:
+        void configure_routes() override {
+            Get("/echo", [](RequestContext) { return ResponseFactory::ok("echo"); });
+            Post("/echo", [](RequestContext ctx) { return ResponseFactory::ok(std::string{ctx.body()}); });
+        }
+    };
+}  // namespace
+
+class ServerTimeoutsTest : public demiplane::test::ServerTest {
+protected:
+    void SetUp() override {
+        server.add_controller(std::make_shared<EchoController>());
+    }
+
+    void start_with(const timeouts& deadlines) {
+        server.set_timeouts(deadlines);
+        start();
+    }
+
+    // The server ends the connection without a response, counting it against @p phase only
+    void expect_closed_by(demiplane::test::Client& client, std::uint64_t TimeoutStats::* phase) {
+        const auto raw = client.read_to_end(2s);
+        ASSERT_TRUE(raw);
+        EXPECT_TRUE(raw->empty());
+        ASSERT_TRUE(demiplane::test::eventually([this, phase] { return server.timeout_stats().*phase == 1; }));
+        const auto stats = server.timeout_stats();
+        EXPECT_EQ(stats.handshake + stats.header + stats.body + stats.idle, 1u);
+    }
+};
+
+TEST_F(ServerTimeoutsTest, HandshakeDeadlineClosesSilentConnection) {
+    start_with({.handshake = 100ms});
+
+    auto client = connect();
+    expect_closed_by(client, &TimeoutStats::handshake);
+}
+
+TEST_F(ServerTimeoutsTest, HeaderDeadlineClosesIncompleteHeader) {
+    start_with({.header = 100ms});
+
+    auto client = connect();
+    ASSERT_TRUE(client.send("GET /echo HTTP/1.1\r\nHost: te"));
+    expect_closed_by(client, &TimeoutStats::header);
+}
+
+TEST_F(ServerTimeoutsTest, BodyDeadlineClosesIncompleteBody) {
+    start_with({.body = 100ms});
+
+    auto client = connect();
+    ASSERT_TRUE(client.send("POST /echo HTTP/1.1\r\nHost: test\r\nContent-Length: 100\r\n\r\nten bytes."));
+    expect_closed_by(client, &TimeoutStats::body);
+}
+
+TEST_F(ServerTimeoutsTest, IdleDeadlineClosesKeepAliveConnection) {
+    start_with({.idle = 100ms});
+
+    auto client = connect();
+    ASSERT_TRUE(client.send("GET /echo HTTP/1.1\r\nHost: test\r\n\r\n"));
+    const auto response = client.read();
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response->body(), "echo");
+    expect_closed_by(client, &TimeoutStats::idle);
+}
+
+TEST_F(ServerTimeoutsTest, DisconnectsSlowlorisClient) {
+    start_with({.header = 300ms});
+
+    // One byte every 20 ms: each byte arrives well within any per-read timeout, the whole header does not
+    const std::string_view header = "GET /echo HTTP/1.1\r\nHost: test\r\nUser-Agent: slowloris\r\nAccept: */*\r\n\r\n";
+    auto client                   = connect();
+    const auto started            = std::chrono::steady_clock::now();
+    for (const char byte : header) {
+        if (!client.send(std::string_view{&byte, 1})) {
+            break;
+        }
+        std::this_thread::sleep_for(20ms);
+        if (server.timeout_stats().header != 0) {
+            break;
+        }
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - started, header.size() * 20ms);
+    expect_closed_by(client, &TimeoutStats::header);
+}
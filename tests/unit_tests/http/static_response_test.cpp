@@ -0,0 +1,71 @@
+#include <static_response.hpp>
+
+#include <boost/asio/buffers_iterator.hpp>
+#include <gtest/gtest.h>
+
+using namespace demiplane::http;
+namespace http = boost::beast::http;
+
+namespace {
+    std::string flatten(const std::array<boost::asio::const_buffer, 2>& buffers) {
+        return {boost::asio::buffers_begin(buffers), boost::asio::buffers_end(buffers)};
+    }
+
+    Request request(const http::verb method, const std::string& if_none_match = {}) {
+        Request req{method, "/health", 11};
+        if (!if_none_match.empty()) {
+            req.set(http::field::if_none_match, if_none_match);
+        }
+        return req;
+    }
+}  // namespace
+
+TEST(StaticResponseTest, RendersHeadAndBodyOnce) {
+    const StaticResponse response{http::status::ok, R"({"status":"ok"})", "application/json"};
+    const auto bytes = flatten(response.answer(request(http::verb::get)));
+
+    EXPECT_TRUE(bytes.starts_with("HTTP/1.1 200 OK\r\n"));
+    EXPECT_NE(bytes.find("Content-Type: application/json\r\n"), std::string::npos);
+    EXPECT_NE(bytes.find("Content-Length: 15\r\n"), std::string::npos);
+    EXPECT_NE(bytes.find("ETag: " + std::string{response.etag()} + "\r\n"), std::string::npos);
+    EXPECT_TRUE(bytes.ends_with("\r\n\r\n{\"status\":\"ok\"}"));
+
+    const auto head = flatten(response.answer(request(http::verb::head)));
+    EXPECT_EQ(head, bytes.substr(0, bytes.size() - 15));
+}
+
+TEST(StaticResponseTest, EtagDependsOnBodyOnly) {
+    const StaticResponse a{http::status::ok, "same", "text/plain"};
+    const StaticResponse b{http::status::not_found, "same", "text/html"};
+    const StaticResponse c{http::status::ok, "other"};
+
+    EXPECT_EQ(a.etag(), b.etag());
+    EXPECT_NE(a.etag(), c.etag());
+    EXPECT_EQ(a.etag().size(), 18u);
+}
+
+TEST(StaticResponseTest, MatchesIfNoneMatchLists) {
+    const StaticResponse response{http::status::ok, "body"};
+    const std::string etag{response.etag()};
+
+    EXPECT_TRUE(response.not_modified(etag));
+    EXPECT_TRUE(response.not_modified("W/" + etag));
+    EXPECT_TRUE(response.not_modified("\"other\" , " + etag));
+    EXPECT_TRUE(response.not_modified("*"));
+    EXPECT_FALSE(response.not_modified("\"other\""));
+    EXPECT_FALSE(response.not_modified(""));
+}
+
+TEST(StaticResponseTest, AnswersRevalidationWithNotModified) {
+    const StaticResponse response{http::status::ok, "body"};
+    const auto bytes = flatten(response.answer(request(http::verb::get, std::string{response.etag()})));
+
+    EXPECT_TRUE(bytes.starts_with("HTTP/1.1 304 Not Modified\r\n"));
+    EXPECT_EQ(bytes.find("body"), std::string::npos);
+
+    auto legacy = request(http::verb::get, std::string{response.etag()});
+    legacy.version(10);
+    EXPECT_FALSE(StaticResponse::fits(legacy));
+    EXPECT_EQ(response.to_response(legacy).result(), http::status::not_modified);
+    EXPECT_EQ(response.to_response(request(http::verb::get)).body(), "body");
+}
@@ -0,0 +1,183 @@
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <response_factory.hpp>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "server_test_fixture.hpp"
+
+using namespace demiplane::http;
+using namespace std::chrono_literals;
+namespace http = boost::beast::http;
+
+namespace {
+    // Deterministic bytes that differ from one position to the next
+    std::string pattern(const std::size_t size) {
+        std::string bytes(size, '\0');
+        for (std::size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<char>('a' + i * 7 % 26);
+        }
+        return bytes;
+    }
+
+    std::string request(const std::string_view head, const std::string_view body = {}) {
+        std::string text{head};
+        text += "Host: test\r\n";
+        if (!body.empty()) {
+            text += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        }
+        text += "\r\n";
+        text += body;
+        return text;
+    }
+
+    std::string body_of(const std::string& raw) {
+        const auto end = raw.find("\r\n\r\n");
+        return end == std::string::npos ? std::string{} : raw.substr(end + 4);
+    }
+}  // namespace
+
+class StreamExchangeTest : public demiplane::test::ServerTest {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        std::ofstream{dir / "small.bin", std::ios::binary} << small;
+        std::ofstream{dir / "large.bin", std::ios::binary} << large;
+
+        // Body pulled in small pieces; the answer is its size and a checksum
+        server.add_stream_route(http::verb::post, "/upload", [](StreamExchange& exchange) -> AsyncVoid {
+            std::array<char, 4096> piece;
+            std::size_t total      = 0;
+            std::uint32_t checksum = 0;
+            while (const auto n = co_await exchange.read_body(boost::asio::buffer(piece))) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    checksum = checksum * 31 + static_cast<unsigned char>(piece[i]);
+                }
+                total += n;
+            }
+            co_await exchange.send(ResponseFactory::ok(std::to_string(total) + " " + std::to_string(checksum)));
+        });
+        server.add_stream_route(http::verb::get, "/chunks", [](StreamExchange& exchange) -> AsyncVoid {
+            co_await exchange.begin_chunked(http::status::ok, "text/plain");
+            co_await exchange.write_chunk(boost::asio::buffer(std::string_view{"hello"}));
+            co_await exchange.write_chunk(boost::asio::buffer(std::string_view{}));
+            co_await exchange.write_chunk(boost::asio::buffer(std::string_view{"world!"}));
+            co_await exchange.end_chunked();
+        });
+        server.add_stream_route(http::verb::get, "/half", [](StreamExchange& exchange) -> AsyncVoid {
+            co_await exchange.begin_chunked(http::status::ok, "text/plain");
+            co_await exchange.write_chunk(boost::asio::buffer(std::string_view{"partial"}));
+        });
+        for (const std::string name : {"small.bin", "large.bin", "missing.bin"}) {
+            server.add_stream_route(
+                http::verb::get, "/" + name, [file = (dir / name).string()](StreamExchange& exchange) -> AsyncVoid {
+                    co_await exchange.send_file(file);
+                });
+        }
+    }
+
+    void TearDown() override {
+        ServerTest::TearDown();
+        std::filesystem::remove_all(dir);
+    }
+
+    static std::uint32_t checksum(const std::string& bytes) {
+        std::uint32_t sum = 0;
+        for (const char c : bytes) {
+            sum = sum * 31 + static_cast<unsigned char>(c);
+        }
+        return sum;
+    }
+
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "stream_exchange_test_dir";
+    const std::string small         = pattern(1000);              // buffered write with the head
+    const std::string large         = pattern(3 * 1024 * 1024);  // sendfile(2) on Linux
+};
+
+TEST_F(StreamExchangeTest, ReadsLargeBodyInPieces) {
+    start();
+
+    // Larger than Beast's default body limit, which a stream route lifts
+    auto client = connect();
+    ASSERT_TRUE(client.send(request("POST /upload HTTP/1.1\r\n", large)));
+    const auto response = client.read(10s);
+    ASSERT_TRUE(response);
+    EXPECT_EQ(response->body(), std::to_string(large.size()) + " " + std::to_string(checksum(large)));
+
+    // The body was read to the end, so the connection stays usable
+    ASSERT_TRUE(client.send(request("POST /upload HTTP/1.1\r\n", "abc")));
+    const auto next = client.read();
+    ASSERT_TRUE(next);
+    EXPECT_EQ(next->body(), "3 " + std::to_string(checksum("abc")));
+}
+
+TEST_F(StreamExchangeTest, BufferedRoutesKeepBodyLimit) {
+    start();
+
+    // Only stream routes lift the limit: anything else is refused on the head alone
+    const auto raw =
+        connect().exchange("POST /elsewhere HTTP/1.1\r\nHost: test\r\nContent-Length: 2000000\r\n\r\n", 2s);
+    ASSERT_TRUE(raw);
+    EXPECT_TRUE(raw->empty());
+}
+
+TEST_F(StreamExchangeTest, FramesChunkedResponse) {
+    start();
+
+    const auto raw = connect().exchange(request("GET /chunks HTTP/1.1\r\nConnection: close\r\n"));
+    ASSERT_TRUE(raw);
+    EXPECT_NE(raw->find("Transfer-Encoding: chunked\r\n"), std::string::npos);
+    EXPECT_EQ(body_of(*raw), "5\r\nhello\r\n6\r\nworld!\r\n0\r\n\r\n");
+
+    // HTTP/1.0 has no chunked coding: the body is written as is and ends with the connection
+    const auto legacy = connect().exchange(request("GET /chunks HTTP/1.0\r\n"));
+    ASSERT_TRUE(legacy);
+    EXPECT_EQ(legacy->find("Transfer-Encoding"), std::string::npos);
+    EXPECT_EQ(body_of(*legacy), "helloworld!");
+}
+
+TEST_F(StreamExchangeTest, SendsFilesThroughBothPaths) {
+    start();
+
+    auto client = connect();
+    for (const auto& [target, content] : {std::pair{"/small.bin", &small}, std::pair{"/large.bin", &large}}) {
+        ASSERT_TRUE(client.send(request("GET " + std::string{target} + " HTTP/1.1\r\n"))) << target;
+        const auto response = client.read(10s);
+        ASSERT_TRUE(response) << target;
+        EXPECT_EQ(response->result(), http::status::ok) << target;
+        EXPECT_EQ(response->at(http::field::content_length), std::to_string(content->size())) << target;
+        EXPECT_TRUE(response->body() == *content) << target;
+    }
+
+    ASSERT_TRUE(client.send(request("GET /missing.bin HTTP/1.1\r\n")));
+    const auto missing = client.read();
+    ASSERT_TRUE(missing);
+    EXPECT_EQ(missing->result(), http::status::not_found);
+}
+
+TEST_F(StreamExchangeTest, BodyDeadlineClosesConnection) {
+    server.set_timeouts({.body = 150ms});
+    start();
+
+    // The head promises more body than ever arrives
+    auto client = connect();
+    ASSERT_TRUE(client.send("POST /upload HTTP/1.1\r\nHost: test\r\nContent-Length: 1000\r\n\r\nonly a little"));
+    const auto raw = client.read_to_end(2s);
+    ASSERT_TRUE(raw);
+    EXPECT_TRUE(raw->empty());
+    EXPECT_TRUE(demiplane::test::eventually([this] { return server.timeout_stats().body == 1; }));
+}
+
+TEST_F(StreamExchangeTest, HalfSentResponseEndsConnection) {
+    start();
+
+    // The handler returns without end_chunked(): the second request must not be answered on this connection
+    const auto raw = connect().exchange(request("GET /half HTTP/1.1\r\n") + request("GET /chunks HTTP/1.1\r\n"), 2s);
+    ASSERT_TRUE(raw);
+    EXPECT_EQ(body_of(*raw), "7\r\npartial\r\n");
+    EXPECT_EQ(raw->find("hello"), std::string::npos);
+}
@@ -105,6 +105,20 @@ TEST(TestEntries, MakeEntryFromEvent) {
     EXPECT_TRUE(light_output.find("INF") != std::string::npos);
 }
 
+TEST(TestEntries, TscTimePointResolvesToWallTime) {
+    detail::MetaTimePoint captured{detail::MetaTimePoint::TscCapture{}};
+    EXPECT_NE(captured.tsc_ticks, 0u);
+
+    captured.resolve(demiplane::chrono::TscClock::calibration());
+    EXPECT_EQ(captured.tsc_ticks, 0u);
+    EXPECT_LT(std::chrono::abs(captured.time_point - std::chrono::system_clock::now()), std::chrono::seconds{1});
+
+    // Already resolved: a second resolve leaves it alone
+    const auto resolved = captured.time_point;
+    captured.resolve(demiplane::chrono::TscClock::calibration());
+    EXPECT_EQ(captured.time_point, resolved);
+}
+
 TEST(TestEntries, DetailedEntryRendersPrefixAndFunction) {
     LogEvent event;
     event.level   = INF;
@@ -0,0 +1,63 @@
+#include <demiplane/scroll>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::scroll;
+
+TEST(LogLevelFloorTest, LevelCompiledInComparesAgainstFloor) {
+    EXPECT_TRUE(level_compiled_in(LogLevel::Info, LogLevel::Info));
+    EXPECT_TRUE(level_compiled_in(LogLevel::Fatal, LogLevel::Debug));
+    EXPECT_FALSE(level_compiled_in(LogLevel::Trace, LogLevel::Debug));
+    EXPECT_TRUE(level_compiled_in(LogLevel::Fatal));
+}
+
+TEST(LogLevelFloorTest, ComponentTableEntryWins) {
+    constexpr std::string_view table = "AsyncExecutor=Info, RouteRegistry = WRN,Server=Trace";
+
+    constexpr auto executor = component_min_level("AsyncExecutor", LogLevel::Trace, table);
+    constexpr auto registry = component_min_level("RouteRegistry", LogLevel::Fatal, table);
+    constexpr auto server   = component_min_level("Server", LogLevel::Error, table);
+    EXPECT_EQ(executor, LogLevel::Info);
+    EXPECT_EQ(registry, LogLevel::Warning);
+    EXPECT_EQ(server, LogLevel::Trace);
+}
+
+TEST(LogLevelFloorTest, DeclaredFloorNeverGoesBelowGlobal) {
+    constexpr auto unlisted = component_min_level("Transaction", LogLevel::Trace, "AsyncExecutor=Info");
+    constexpr auto raised   = component_min_level("Transaction", LogLevel::Fatal, "");
+    EXPECT_EQ(unlisted, compiled_min_level);
+    EXPECT_EQ(raised, LogLevel::Fatal);
+}
+
+#ifdef DMP_COMPONENT_LOGGING
+namespace {
+    int evaluated = 0;
+
+    int count_evaluation() {
+        return ++evaluated;
+    }
+
+    struct FloorProbe {
+        SCROLL_COMPONENT_PREFIX("FloorProbe", ::demiplane::scroll::LogLevel::Error);
+
+        void log_all_levels() {
+            COMPONENT_LOG_TRC() << count_evaluation();
+            COMPONENT_LOG_DBG() << SCROLL_PARAMS(evaluated) << count_evaluation();
+            COMPONENT_LOG_WRN_ONCE() << count_evaluation();
+            COMPONENT_LOG_ERR() << count_evaluation();
+        }
+    };
+}  // namespace
+
+TEST(LogLevelFloorTest, CallsBelowComponentFloorAreNotEvaluated) {
+    ComponentLoggerManager::set_logger(std::make_shared<Logger>());
+    evaluated = 0;
+
+    FloorProbe{}.log_all_levels();
+    ComponentLoggerManager::set_logger(nullptr);
+
+    EXPECT_EQ(FloorProbe::_dmp_scroll_class_min_level,
+              level_compiled_in(LogLevel::Error) ? LogLevel::Error : compiled_min_level);
+    EXPECT_EQ(evaluated, level_compiled_in(LogLevel::Error) ? 1 : 0);
+}
+#endif
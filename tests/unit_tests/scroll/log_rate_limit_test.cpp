@@ -0,0 +1,143 @@
+#include <atomic>
+#include <demiplane/scroll>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::scroll;
+using namespace std::chrono_literals;
+
+TEST(LogRateLimitTest, EveryNEmitsFirstAndEveryNth) {
+    EveryN sampler;
+    std::vector<std::uint64_t> suppressed;
+    for (int i = 0; i < 25; ++i) {
+        if (const auto decision = sampler.check(10)) {
+            suppressed.push_back(decision.suppressed);
+        }
+    }
+    const std::vector<std::uint64_t> expected{0, 9, 9};
+    EXPECT_EQ(suppressed, expected);
+}
+
+TEST(LogRateLimitTest, EveryNOfOneAlwaysEmits) {
+    EveryN sampler;
+    for (int i = 0; i < 5; ++i) {
+        const auto decision = sampler.check(1);
+        EXPECT_TRUE(decision.emit);
+        EXPECT_EQ(decision.suppressed, 0u);
+    }
+}
+
+TEST(LogRateLimitTest, EveryIntervalReportsSuppressedCount) {
+    EveryInterval sampler;
+    EXPECT_TRUE(sampler.check(100ms, 0).emit);
+    EXPECT_FALSE(sampler.check(100ms, 10'000'000).emit);
+    EXPECT_FALSE(sampler.check(100ms, 99'999'999).emit);
+
+    const auto decision = sampler.check(100ms, 100'000'000);
+    EXPECT_TRUE(decision.emit);
+    EXPECT_EQ(decision.suppressed, 2u);
+}
+
+TEST(LogRateLimitTest, TokenBucketAllowsBurstThenSustainedRate) {
+    TokenBucket bucket;
+    int emitted = 0;
+    for (int i = 0; i < 10; ++i) {
+        emitted += bucket.check(10.0, 3, 0).emit ? 1 : 0;
+    }
+    EXPECT_EQ(emitted, 3);
+
+    // One token refills every 100ms at 10/s
+    EXPECT_FALSE(bucket.check(10.0, 3, 50'000'000).emit);
+    const auto decision = bucket.check(10.0, 3, 100'000'000);
+    EXPECT_TRUE(decision.emit);
+    EXPECT_EQ(decision.suppressed, 8u);
+    EXPECT_FALSE(bucket.check(10.0, 3, 100'000'000).emit);
+}
+
+TEST(LogRateLimitTest, EveryNIsExactUnderContention) {
+    EveryN sampler;
+    std::atomic<int> emitted{0};
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 10'000; ++i) {
+                if (sampler.check(100)) {
+                    emitted.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    threads.clear();
+    EXPECT_EQ(emitted.load(), 400);
+}
+
+class SampledService final : public LoggerProvider {
+public:
+    SampledService() {
+        auto logger = std::make_shared<Logger>();
+        logger->add_sink(std::make_shared<ConsoleSink<LightEntry>>(ConsoleSinkConfig::Builder{}
+                                                                       .threshold(LogLevel::Debug)
+                                                                       .enable_colors(false)
+                                                                       .flush_each_entry(true)
+                                                                       .finalize()));
+        set_logger(std::move(logger));
+    }
+
+    void hot_loop(const int iterations) {
+        for (int i = 0; i < iterations; ++i) {
+            LOG_WRN_EVERY_N(4) << "stream sample " << i;
+            LOG_INF_EVERY_N(4, "format sample {}", i);
+        }
+        get_logger()->shutdown();
+    }
+
+    // Unbraced on purpose: the else must bind to this if, not to one inside the macro
+    void branch(const bool taken) {
+        if (taken)
+            LOG_WRN_EVERY_N(1) << "taken branch";
+        else
+            LOG_WRN_EVERY_N(1) << "else branch";
+        if (!taken)
+            LOG_INF_ONCE() << "once in else test";
+        else
+            LOG_INF_RATE(100.0, 10, "rate in else test");
+    }
+
+    void finish() {
+        get_logger()->shutdown();
+    }
+};
+
+TEST(LogRateLimitTest, MacrosEmitSampledLinesWithSuppressedSuffix) {
+    SampledService service;
+    testing::internal::CaptureStdout();
+    service.hot_loop(9);
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    for (const int i : {0, 4, 8}) {
+        EXPECT_NE(output.find("stream sample " + std::to_string(i)), std::string::npos);
+        EXPECT_NE(output.find("format sample " + std::to_string(i)), std::string::npos);
+    }
+    for (const int i : {1, 2, 3, 5, 6, 7}) {
+        EXPECT_EQ(output.find("stream sample " + std::to_string(i)), std::string::npos);
+        EXPECT_EQ(output.find("format sample " + std::to_string(i)), std::string::npos);
+    }
+    EXPECT_NE(output.find("stream sample 4 [suppressed 3]"), std::string::npos);
+    EXPECT_NE(output.find("format sample 8 [suppressed 3]"), std::string::npos);
+    EXPECT_EQ(output.find("sample 0 [suppressed"), std::string::npos);
+}
+
+TEST(LogRateLimitTest, MacrosKeepElseOfUnbracedIf) {
+    SampledService service;
+    testing::internal::CaptureStdout();
+    service.branch(true);
+    service.finish();
+    const std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(output.find("taken branch"), std::string::npos);
+    EXPECT_EQ(output.find("else branch"), std::string::npos);
+    EXPECT_NE(output.find("rate in else test"), std::string::npos);
+    EXPECT_EQ(output.find("once in else test"), std::string::npos);
+}
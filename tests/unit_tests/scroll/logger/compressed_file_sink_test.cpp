@@ -0,0 +1,131 @@
+#include <demiplane/scroll>
+#include <filesystem>
+#include <optional>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <zstd.h>
+
+#include "sink_test_fixture.hpp"
+
+using namespace demiplane::scroll;
+
+class CompressedFileSinkTest : public demiplane::test::ScratchDirTest {
+protected:
+    CompressedFileSinkTest()
+        : ScratchDirTest{"compressed_sink_test_dir"} {
+    }
+
+    [[nodiscard]] CompressedFileSinkConfig make_config(const std::uint64_t frame_size,
+                                                       const std::chrono::milliseconds interval) const {
+        return sink_config<CompressedFileSinkConfig>(dir / "app.zst")
+            .frame_size(frame_size)
+            .frame_interval(interval)
+            .finalize();
+    }
+
+    /// Decode every frame in the file; nullopt if the data ends mid-frame or is corrupt
+    [[nodiscard]] static std::optional<std::string> decode(const std::filesystem::path& path) {
+        const std::string compressed = read_file(path);
+
+        ZSTD_DCtx* dctx = ZSTD_createDCtx();
+        std::string out;
+        std::vector<char> buf(ZSTD_DStreamOutSize());
+        ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+        std::size_t ret = 0;
+        while (input.pos < input.size) {
+            ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+            ret = ZSTD_decompressStream(dctx, &output, &input);
+            if (ZSTD_isError(ret)) {
+                ZSTD_freeDCtx(dctx);
+                return std::nullopt;
+            }
+            out.append(buf.data(), output.pos);
+        }
+        ZSTD_freeDCtx(dctx);
+        if (ret != 0) {
+            return std::nullopt;
+        }
+        return out;
+    }
+};
+
+TEST_F(CompressedFileSinkTest, RoundTripsAllEntries) {
+    std::string expected;
+    {
+        CompressedFileSink<LightEntry> sink{make_config(256, std::chrono::milliseconds::zero())};
+        for (int i = 0; i < 200; ++i) {
+            const std::string message = "compressed entry " + std::to_string(i);
+            sink.process(make_event(INF, message));
+            expected += "INF " + message + "\n";
+        }
+    }
+
+    const auto decoded = decode(dir / "app.zst");
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, expected);
+    EXPECT_LT(std::filesystem::file_size(dir / "app.zst"), expected.size());
+}
+
+TEST_F(CompressedFileSinkTest, FlushMakesFileDecodableWhileOpen) {
+    CompressedFileSink<LightEntry> sink{make_config(1 << 20, std::chrono::milliseconds::zero())};
+    sink.process(make_event(INF, "first"));
+    sink.process(make_event(WRN, "second"));
+    sink.flush();
+
+    const auto decoded = decode(sink.file_path());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, "INF first\nWRN second\n");
+}
+
+TEST_F(CompressedFileSinkTest, IntervalClosesIdleFrame) {
+    CompressedFileSink<LightEntry> sink{make_config(1 << 20, std::chrono::milliseconds{20})};
+    sink.process(make_event(ERR, "quiet tail"));
+
+    std::optional<std::string> decoded;
+    for (int attempt = 0; attempt < 100 && !decoded; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        if (std::filesystem::file_size(sink.file_path()) != 0) {
+            decoded = decode(sink.file_path());
+        }
+    }
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, "ERR quiet tail\n");
+}
+
+TEST_F(CompressedFileSinkTest, AppendsFramesToExistingFile) {
+    {
+        CompressedFileSink<LightEntry> sink{make_config(1 << 20, std::chrono::milliseconds::zero())};
+        sink.process(make_event(INF, "run one"));
+    }
+    {
+        CompressedFileSink<LightEntry> sink{make_config(1 << 20, std::chrono::milliseconds::zero())};
+        sink.process(make_event(INF, "run two"));
+    }
+
+    const auto decoded = decode(dir / "app.zst");
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, "INF run one\nINF run two\n");
+}
+
+TEST_F(CompressedFileSinkTest, FiltersEntriesBelowThreshold) {
+    {
+        CompressedFileSink<LightEntry> sink{
+            CompressedFileSinkConfig::Builder{make_config(1 << 20, std::chrono::milliseconds::zero())}
+                .threshold(ERR)
+                .finalize()};
+        sink.process(make_event(INF, "dropped"));
+        sink.process(make_event(ERR, "kept"));
+    }
+
+    const auto decoded = decode(dir / "app.zst");
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(*decoded, "ERR kept\n");
+}
+
+TEST_F(CompressedFileSinkTest, RejectsInvalidConfig) {
+    EXPECT_THROW(std::ignore = CompressedFileSinkConfig::Builder{}.file("app.zst").compression_level(0).finalize(),
+                 std::invalid_argument);
+    EXPECT_THROW(std::ignore = CompressedFileSinkConfig::Builder{}.file("app.zst").frame_size(0).finalize(),
+                 std::invalid_argument);
+}
@@ -0,0 +1,120 @@
+#include <csignal>
+#include <demiplane/scroll>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include "sink_test_fixture.hpp"
+
+using namespace demiplane::scroll;
+
+class CrashHandlerTest : public demiplane::test::ScratchDirTest {
+protected:
+    const std::filesystem::path path = dir / "crash.log";
+
+    CrashHandlerTest()
+        : ScratchDirTest{"crash_handler_test_dir"} {
+    }
+
+    [[nodiscard]] FileSinkConfig make_config() const {
+        return make_config(path);
+    }
+
+    [[nodiscard]] static FileSinkConfig make_config(const std::filesystem::path& file) {
+        return sink_config<FileSinkConfig>(file).rotation(false).flush_each_entry(false).finalize();
+    }
+
+    [[nodiscard]] std::string read_log_file() const {
+        return read_file(path);
+    }
+};
+
+TEST_F(CrashHandlerTest, FileSinkCrashFlushWritesPendingBuffer) {
+    FileSink<LightEntry> sink{make_config()};
+    sink.process(make_event(INF, "buffered one"));
+    sink.process(make_event(ERR, "buffered two"));
+
+    // Still sitting in the 64KB stream buffer
+    EXPECT_EQ(read_log_file(), "");
+
+    // Without a CrashHandler the sink keeps no descriptor to write it through
+    sink.crash_flush();
+    EXPECT_EQ(read_log_file(), "");
+
+    sink.prepare_crash_flush();
+    sink.crash_flush();
+    EXPECT_EQ(read_log_file(), "INF buffered one\nERR buffered two\n");
+}
+
+TEST_F(CrashHandlerTest, InstallPreparesSinksAddedBeforeAndAfter) {
+    const auto later_path = dir / "later.log";
+    auto early            = std::make_shared<FileSink<LightEntry>>(make_config());
+    auto later            = std::make_shared<FileSink<LightEntry>>(make_config(later_path));
+
+    Logger logger;
+    logger.add_sink(early);
+    CrashHandler::install();
+    logger.add_sink(later);
+    early->process(make_event(INF, "early"));
+    later->process(make_event(INF, "later"));
+
+    early->crash_flush();
+    later->crash_flush();
+    CrashHandler::uninstall();
+    EXPECT_EQ(read_log_file(), "INF early\n");
+    EXPECT_EQ(read_file(later_path), "INF later\n");
+}
+
+TEST_F(CrashHandlerTest, DumpWritesBacktrace) {
+    std::array<int, 2> fds{};
+    ASSERT_EQ(::pipe(fds.data()), 0);
+
+    CrashHandler::dump(fds[1]);
+    ::close(fds[1]);
+
+    std::string output;
+    std::array<char, 4096> buf{};
+    for (ssize_t n; (n = ::read(fds[0], buf.data(), buf.size())) > 0;) {
+        output.append(buf.data(), static_cast<std::size_t>(n));
+    }
+    ::close(fds[0]);
+
+    EXPECT_NE(output.find("backtrace"), std::string::npos);
+}
+
+TEST_F(CrashHandlerTest, InstallIsIdempotentAndReversible) {
+    CrashHandler::install();
+    CrashHandler::install();
+    EXPECT_TRUE(CrashHandler::installed());
+
+    CrashHandler::uninstall();
+    EXPECT_FALSE(CrashHandler::installed());
+}
+
+using CrashHandlerDeathTest = CrashHandlerTest;
+
+TEST_F(CrashHandlerDeathTest, AbortReportsSignalAndReRaises) {
+    EXPECT_DEATH(
+        {
+            CrashHandler::install();
+            std::abort();
+        },
+        "scroll: fatal SIGABRT");
+}
+
+TEST_F(CrashHandlerDeathTest, SegfaultFlushesSinkBuffers) {
+    EXPECT_DEATH(
+        {
+            auto sink = std::make_shared<FileSink<LightEntry>>(make_config());
+            Logger logger;
+            logger.add_sink(sink);
+            sink->process(make_event(WRN, "last words"));
+
+            CrashHandler::install();
+            std::raise(SIGSEGV);
+        },
+        "scroll: fatal SIGSEGV");
+
+    EXPECT_EQ(read_log_file(), "WRN last words\n");
+}
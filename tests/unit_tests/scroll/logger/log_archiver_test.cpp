@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <array>
+#include <demiplane/scroll>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::scroll;
+
+class LogArchiverTest : public ::testing::Test {
+protected:
+    const std::filesystem::path dir = "log_archiver_test_dir";
+
+    void SetUp() override {
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    static constexpr auto time_format = demiplane::chrono::clock_formats::iso8601;
+
+    // app_<time>.log of the index-th second
+    [[nodiscard]] static std::string rotated_name(const std::size_t index, const std::string_view stem = "app") {
+        return std::string{stem} + "_2025-01-18T10:00:" + (index < 10 ? "0" : "") + std::to_string(index) + ".log";
+    }
+
+    // Rotated files are written a few ms apart so retention sees a stable mtime order
+    [[nodiscard]] std::filesystem::path write_rotated(const std::size_t index,
+                                                      const std::size_t lines     = 1000,
+                                                      const std::string_view stem = "app") const {
+        const auto path = dir / rotated_name(index, stem);
+        std::ofstream file{path};
+        for (std::size_t i = 0; i < lines; ++i) {
+            file << "INF rotated entry " << i << '\n';
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        return path;
+    }
+
+    [[nodiscard]] std::vector<std::string> files() const {
+        std::vector<std::string> out;
+        for (const auto& entry : std::filesystem::directory_iterator{dir}) {
+            out.push_back(entry.path().filename().string());
+        }
+        std::ranges::sort(out);
+        return out;
+    }
+};
+
+TEST_F(LogArchiverTest, CompressesClosedFileAndRemovesOriginal) {
+    const auto closed = write_rotated(0);
+    const auto active = write_rotated(1, 1);
+    const auto size   = std::filesystem::file_size(closed);
+
+    {
+        LogArchiver archiver{ArchivePolicy{.compression = RotationCompression::Zstd}, dir / "app.log", time_format};
+        archiver.submit(closed, active);
+        archiver.wait_idle();
+    }
+
+    auto compressed = closed;
+    compressed += ".zst";
+    ASSERT_TRUE(std::filesystem::exists(compressed));
+    EXPECT_FALSE(std::filesystem::exists(closed));
+    EXPECT_TRUE(std::filesystem::exists(active));
+    EXPECT_LT(std::filesystem::file_size(compressed), size);
+
+    std::ifstream file{compressed, std::ios::binary};
+    std::array<unsigned char, 4> magic{};
+    file.read(reinterpret_cast<char*>(magic.data()), magic.size());
+    constexpr std::array<unsigned char, 4> zstd_magic{0x28, 0xB5, 0x2F, 0xFD};
+    EXPECT_EQ(magic, zstd_magic);
+}
+
+TEST_F(LogArchiverTest, KeepsOnlyNewestRotatedFiles) {
+    std::vector<std::filesystem::path> rotated;
+    for (std::size_t i = 0; i < 5; ++i) {
+        rotated.push_back(write_rotated(i));
+    }
+    const auto active = write_rotated(5, 1);
+
+    {
+        LogArchiver archiver{ArchivePolicy{.max_retained_files = 2}, dir / "app.log", time_format};
+        archiver.submit(rotated.back(), active);
+    }  // destructor drains pending work
+
+    const std::vector<std::string> expected{rotated_name(3), rotated_name(4), rotated_name(5)};
+    EXPECT_EQ(files(), expected);
+}
+
+TEST_F(LogArchiverTest, RetentionCountsCompressedFiles) {
+    std::vector<std::filesystem::path> rotated;
+    for (std::size_t i = 0; i < 4; ++i) {
+        rotated.push_back(write_rotated(i));
+    }
+    const auto active = write_rotated(4, 1);
+
+    {
+        LogArchiver archiver{ArchivePolicy{.compression = RotationCompression::Zstd, .max_retained_files = 2},
+                             dir / "app.log",
+                             time_format};
+        for (const auto& path : rotated) {
+            archiver.submit(path, active);
+        }
+        archiver.wait_idle();
+    }
+
+    const std::vector<std::string> expected{rotated_name(2) + ".zst", rotated_name(3) + ".zst", rotated_name(4)};
+    EXPECT_EQ(files(), expected);
+}
+
+TEST_F(LogArchiverTest, ByteCapDeletesOldestFirst) {
+    std::vector<std::filesystem::path> rotated;
+    for (std::size_t i = 0; i < 4; ++i) {
+        rotated.push_back(write_rotated(i));
+    }
+    const auto active = write_rotated(4, 1);
+    const auto one    = std::filesystem::file_size(rotated.front());
+
+    {
+        LogArchiver archiver{ArchivePolicy{.max_retained_bytes = one * 2}, dir / "app.log", time_format};
+        archiver.submit(rotated.back(), active);
+        archiver.wait_idle();
+    }
+
+    const std::vector<std::string> expected{rotated_name(2), rotated_name(3), rotated_name(4)};
+    EXPECT_EQ(files(), expected);
+}
+
+TEST_F(LogArchiverTest, IgnoresFilesOutsideTheFamily) {
+    const auto closed = write_rotated(0);
+    const auto active = write_rotated(1, 1);
+    std::ofstream{dir / "other_0.log"} << "unrelated\n";
+
+    {
+        LogArchiver archiver{
+            ArchivePolicy{.max_retained_files = 0, .max_retained_bytes = 1}, dir / "app.log", time_format};
+        archiver.submit(closed, active);
+        archiver.wait_idle();
+    }
+
+    const std::vector<std::string> expected{rotated_name(1), "other_0.log"};
+    EXPECT_EQ(files(), expected);
+}
+
+TEST_F(LogArchiverTest, KeepsFilesOfSiblingSinkWithSharedPrefix) {
+    // app_audit.log is another sink: its active file and its rotated files start with "app_" too
+    std::ignore = write_rotated(0, 1000, "app_audit");
+    std::ofstream{dir / "app_audit.log"} << "sibling active\n";
+    std::ofstream{dir / "app_notes.log.zst"} << "not a timestamp\n";
+    const auto closed = write_rotated(1);
+    const auto active = write_rotated(2, 1);
+
+    {
+        LogArchiver archiver{
+            ArchivePolicy{.max_retained_files = 0, .max_retained_bytes = 1}, dir / "app.log", time_format};
+        archiver.submit(closed, active);
+        archiver.wait_idle();
+    }
+
+    const std::vector<std::string> expected{
+        rotated_name(2), "app_audit.log", rotated_name(0, "app_audit"), "app_notes.log.zst"};
+    EXPECT_EQ(files(), expected);
+}
+
+TEST(FileSinkConfigArchiveTest, RejectsOutOfRangeCompressionLevel) {
+    EXPECT_THROW(std::ignore = FileSinkConfig::Builder{}
+                                   .file("app.log")
+                                   .compression(RotationCompression::Zstd)
+                                   .compression_level(42)
+                                   .finalize(),
+                 std::invalid_argument);
+}
+
+TEST(FileSinkConfigArchiveTest, ArchivePolicyReflectsConfig) {
+    const auto cfg = FileSinkConfig::Builder{}
+                         .file("app.log")
+                         .compression(RotationCompression::Zstd)
+                         .compression_level(5)
+                         .max_retained_files(7)
+                         .max_retained_bytes(1024)
+                         .finalize();
+
+    const auto policy = cfg.archive_policy();
+    EXPECT_TRUE(policy.enabled());
+    EXPECT_EQ(policy.compression, RotationCompression::Zstd);
+    EXPECT_EQ(policy.compression_level, 5);
+    EXPECT_EQ(policy.max_retained_files, 7u);
+    EXPECT_EQ(policy.max_retained_bytes, 1024u);
+
+    EXPECT_FALSE(FileSinkConfig::Builder{}.file("app.log").finalize().archive_policy().enabled());
+}
@@ -0,0 +1,155 @@
+#include <chrono>
+#include <csignal>
+#include <demiplane/scroll>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::scroll;
+
+namespace {
+    const std::filesystem::path reconfigure_dir = "reconfigure_test_logs";
+
+    FileSinkConfig file_config(const std::filesystem::path& file) {
+        return FileSinkConfig::Builder{}
+            .threshold(LogLevel::Debug)
+            .file(file)
+            .add_time_to_filename(false)
+            .rotation(false)
+            .flush_each_entry(true)
+            .finalize();
+    }
+
+    std::string read_file(const std::filesystem::path& path) {
+        std::ifstream file{path};
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    /// Counts reopen() calls; accepts everything
+    class ReopenCountingSink final : public Sink {
+    public:
+        void process(const LogEvent& /*event*/) override {
+        }
+        void flush() override {
+        }
+        void reopen() override {
+            reopens.fetch_add(1, std::memory_order_relaxed);
+        }
+        [[nodiscard]] bool should_log(LogLevel, std::string_view) const noexcept override {
+            return true;
+        }
+
+        std::atomic<int> reopens{0};
+    };
+}  // namespace
+
+class LoggerReconfigureTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(reconfigure_dir);
+        std::filesystem::create_directories(reconfigure_dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(reconfigure_dir);
+    }
+};
+
+TEST_F(LoggerReconfigureTest, ThresholdChangeAppliesBetweenBatches) {
+    std::ostringstream out;
+    Logger logger;
+    const auto id = logger.add_sink(std::make_shared<ConsoleSink<LightEntry>>(
+        ConsoleSinkConfig::Builder{}.threshold(LogLevel::Debug).enable_colors(false).output(&out).finalize()));
+
+    logger.log(DBG, "before reconfigure");
+    auto stricter = ConsoleSinkConfig::Builder{}
+                        .threshold(LogLevel::Error)
+                        .enable_colors(false)
+                        .output(&out)
+                        .finalize();
+    logger.reconfigure(id, std::move(stricter)).get();
+    logger.log(DBG, "filtered after reconfigure");
+    logger.log(ERR, "kept after reconfigure");
+    logger.shutdown();
+
+    const std::string output = out.str();
+    EXPECT_NE(output.find("before reconfigure"), std::string::npos);
+    EXPECT_EQ(output.find("filtered after reconfigure"), std::string::npos);
+    EXPECT_NE(output.find("kept after reconfigure"), std::string::npos);
+}
+
+TEST_F(LoggerReconfigureTest, FileTargetChangeMovesLaterEvents) {
+    const auto first  = reconfigure_dir / "first.log";
+    const auto second = reconfigure_dir / "second.log";
+
+    Logger logger;
+    const auto id = logger.add_sink(std::make_shared<FileSink<LightEntry>>(file_config(first)));
+
+    logger.log(INF, "goes to first");
+    logger.reconfigure(id, file_config(second)).get();
+    logger.log(INF, "goes to second");
+    logger.shutdown();
+
+    const std::string first_content  = read_file(first);
+    const std::string second_content = read_file(second);
+    EXPECT_NE(first_content.find("goes to first"), std::string::npos);
+    EXPECT_EQ(first_content.find("goes to second"), std::string::npos);
+    EXPECT_NE(second_content.find("goes to second"), std::string::npos);
+}
+
+TEST_F(LoggerReconfigureTest, RejectsConfigOfAnotherSinkType) {
+    Logger logger;
+    const auto id = logger.add_sink(std::make_shared<ConsoleSink<LightEntry>>(ConsoleSinkConfig::Builder{}.finalize()));
+
+    EXPECT_THROW(std::ignore = logger.reconfigure(id, file_config(reconfigure_dir / "x.log")), std::invalid_argument);
+    EXPECT_THROW(std::ignore = logger.reconfigure(id + 1, ConsoleSinkConfig::Builder{}.finalize()), std::out_of_range);
+}
+
+TEST_F(LoggerReconfigureTest, ReopenFollowsLogrotate) {
+    const auto active  = reconfigure_dir / "app.log";
+    const auto rotated = reconfigure_dir / "app.log.1";
+
+    Logger logger;
+    logger.add_sink(std::make_shared<FileSink<LightEntry>>(file_config(active)));
+
+    logger.log(INF, "before rotation");
+    std::filesystem::rename(active, rotated);  // what logrotate does before its postrotate hook
+
+    logger.reopen().get();
+    logger.log(INF, "after rotation");
+    logger.shutdown();
+
+    EXPECT_NE(read_file(rotated).find("before rotation"), std::string::npos);
+    const std::string fresh = read_file(active);
+    EXPECT_NE(fresh.find("after rotation"), std::string::npos);
+    EXPECT_EQ(fresh.find("before rotation"), std::string::npos);
+}
+
+TEST_F(LoggerReconfigureTest, SignalRequestsReopenBeforeNextDispatch) {
+    Logger logger;
+    auto sink = std::make_shared<ReopenCountingSink>();
+    logger.add_sink(sink);
+
+    ReopenSignal::install(SIGUSR1);
+    std::raise(SIGUSR1);
+    logger.log(INF, "wakes the consumer");
+    logger.shutdown();
+    ReopenSignal::uninstall();
+
+    EXPECT_EQ(sink->reopens.load(), 1);
+}
+
+TEST_F(LoggerReconfigureTest, ReconfigureAfterShutdownAppliesInline) {
+    std::ostringstream out;
+    Logger logger;
+    const auto id = logger.add_sink(std::make_shared<ConsoleSink<LightEntry>>(
+        ConsoleSinkConfig::Builder{}.threshold(LogLevel::Debug).output(&out).finalize()));
+    logger.shutdown();
+
+    auto applied = logger.reconfigure(id, ConsoleSinkConfig::Builder{}.threshold(LogLevel::Fatal).finalize());
+    EXPECT_EQ(applied.wait_for(std::chrono::seconds{0}), std::future_status::ready);
+}
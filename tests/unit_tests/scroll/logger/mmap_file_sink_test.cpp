@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <demiplane/scroll>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+#include "sink_test_fixture.hpp"
+
+using namespace demiplane::scroll;
+
+class MmapFileSinkTest : public demiplane::test::ScratchDirTest {
+protected:
+    MmapFileSinkTest()
+        : ScratchDirTest{"mmap_sink_test_dir"} {
+    }
+
+    [[nodiscard]] MmapFileSinkConfig make_config(const std::uint64_t segment_size) const {
+        return sink_config<MmapFileSinkConfig>(dir / "mmap.log").max_file_size(segment_size).finalize();
+    }
+
+    [[nodiscard]] std::vector<std::filesystem::path> segments() const {
+        std::vector<std::filesystem::path> out;
+        for (const auto& entry : std::filesystem::directory_iterator{dir}) {
+            out.push_back(entry.path());
+        }
+        std::ranges::sort(out);
+        return out;
+    }
+};
+
+TEST_F(MmapFileSinkTest, WritesEntriesAndTruncatesOnClose) {
+    {
+        MmapFileSink<LightEntry> sink{make_config(4096)};
+        sink.process(make_event(INF, "first"));
+        sink.process(make_event(WRN, "second"));
+    }
+
+    const auto files = segments();
+    ASSERT_EQ(files.size(), 1u);
+
+    const std::string content = read_file(files.front());
+    EXPECT_EQ(content, "INF first\nWRN second\n");
+    EXPECT_EQ(content.find('\0'), std::string::npos);
+}
+
+TEST_F(MmapFileSinkTest, FiltersEntriesBelowThreshold) {
+    {
+        MmapFileSink<LightEntry> sink{MmapFileSinkConfig::Builder{make_config(4096)}.threshold(ERR).finalize()};
+        sink.process(make_event(INF, "dropped"));
+        sink.process(make_event(ERR, "kept"));
+    }
+
+    const std::string content = read_file(segments().front());
+    EXPECT_EQ(content, "ERR kept\n");
+}
+
+TEST_F(MmapFileSinkTest, RollsToNextSegmentWhenFull) {
+    constexpr std::size_t entries = 64;
+    {
+        MmapFileSink<LightEntry> sink{make_config(128)};
+        for (std::size_t i = 0; i < entries; ++i) {
+            sink.process(make_event(INF, "entry " + std::to_string(i)));
+        }
+    }
+
+    const auto files = segments();
+    EXPECT_GT(files.size(), 1u);
+
+    std::string all;
+    for (const auto& file : files) {
+        const std::string content = read_file(file);
+        EXPECT_LE(content.size(), 128u);
+        all += content;
+    }
+    for (std::size_t i = 0; i < entries; ++i) {
+        EXPECT_NE(all.find("INF entry " + std::to_string(i) + "\n"), std::string::npos);
+    }
+}
+
+TEST_F(MmapFileSinkTest, OversizedEntryGetsDedicatedSegment) {
+    const std::string big(512, 'x');
+    {
+        MmapFileSink<LightEntry> sink{make_config(64)};
+        sink.process(make_event(INF, "small"));
+        sink.process(make_event(INF, big));
+    }
+
+    const auto files = segments();
+    ASSERT_EQ(files.size(), 2u);
+    EXPECT_EQ(read_file(files[0]), "INF small\n");
+    EXPECT_EQ(read_file(files[1]), "INF " + big + "\n");
+}
+
+TEST_F(MmapFileSinkTest, WorksThroughLogger) {
+    auto sink = std::make_shared<MmapFileSink<DetailedEntry>>(make_config(1 << 20));
+    {
+        Logger logger;
+        logger.add_sink(sink);
+        logger.log(INF, "through logger");
+        logger.shutdown();
+    }
+    const auto path = sink->file_path();
+    sink.reset();
+
+    const std::string content = read_file(path);
+    EXPECT_NE(content.find("through logger"), std::string::npos);
+    EXPECT_NE(content.find("INF"), std::string::npos);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+// Shared pieces of the file-backed sink tests
+
+#include <demiplane/scroll>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace demiplane::test {
+
+    // Base fixture: every test starts with an empty scratch directory, removed again afterwards
+    class ScratchDirTest : public ::testing::Test {
+    protected:
+        explicit ScratchDirTest(std::filesystem::path scratch)
+            : dir{std::move(scratch)} {
+        }
+
+        void SetUp() override {
+            std::filesystem::remove_all(dir);
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(dir);
+        }
+
+        // Builder preset for a sink writing @p file: every level, no timestamp in the name
+        template <typename Config>
+        [[nodiscard]] static typename Config::Builder sink_config(const std::filesystem::path& file) {
+            return typename Config::Builder{}.threshold(scroll::DBG).file(file).add_time_to_filename(false);
+        }
+
+        [[nodiscard]] static std::string read_file(const std::filesystem::path& path) {
+            std::ifstream file{path, std::ios::binary};
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            return buffer.str();
+        }
+
+        [[nodiscard]] static scroll::LogEvent make_event(const scroll::LogLevel lvl, std::string message) {
+            scroll::LogEvent event;
+            event.level   = lvl;
+            event.message = std::move(message);
+            return event;
+        }
+
+        const std::filesystem::path dir;
+    };
+
+}  // namespace demiplane::test
@@ -0,0 +1,208 @@
+#include <chrono>
+#include <cstring>
+#include <demiplane/scroll>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace demiplane::scroll;
+
+namespace {
+    /// Stand-in for the local log agent: a bound datagram socket with a receive timeout
+    class DatagramReceiver {
+    public:
+        static DatagramReceiver unix_at(const std::filesystem::path& path) {
+            std::filesystem::remove(path);
+            DatagramReceiver receiver{::socket(AF_UNIX, SOCK_DGRAM, 0)};
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+            EXPECT_EQ(::bind(receiver.fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+            return receiver;
+        }
+
+        static DatagramReceiver udp_loopback() {
+            DatagramReceiver receiver{::socket(AF_INET, SOCK_DGRAM, 0)};
+            sockaddr_in addr{};
+            addr.sin_family      = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            EXPECT_EQ(::bind(receiver.fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+            socklen_t length = sizeof(addr);
+            ::getsockname(receiver.fd_, reinterpret_cast<sockaddr*>(&addr), &length);
+            receiver.port_ = ntohs(addr.sin_port);
+            return receiver;
+        }
+
+        DatagramReceiver(DatagramReceiver&& other) noexcept
+            : fd_{std::exchange(other.fd_, -1)},
+              port_{other.port_} {
+        }
+
+        ~DatagramReceiver() {
+            if (fd_ >= 0) {
+                ::close(fd_);
+            }
+        }
+
+        [[nodiscard]] std::optional<std::string> receive() const {
+            char buffer[65536];
+            const ssize_t n = ::recv(fd_, buffer, sizeof(buffer), 0);
+            if (n < 0) {
+                return std::nullopt;
+            }
+            return std::string{buffer, static_cast<std::size_t>(n)};
+        }
+
+        [[nodiscard]] std::uint16_t port() const noexcept {
+            return port_;
+        }
+
+    private:
+        int fd_             = -1;
+        std::uint16_t port_ = 0;
+
+        explicit DatagramReceiver(const int fd)
+            : fd_{fd} {
+            timeval timeout{.tv_sec = 1, .tv_usec = 0};
+            ::setsockopt(fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
+    };
+
+    LogEvent make_event(const LogLevel level, const std::string& message, const std::string_view prefix = {}) {
+        LogEvent event;
+        event.level      = level;
+        event.message    = message;
+        event.location   = detail::MetaSource{std::source_location::current()};
+        event.time_point = detail::MetaTimePoint{};
+        event.prefix.assign(prefix);
+        return event;
+    }
+}  // namespace
+
+class SocketSinkTest : public ::testing::Test {
+protected:
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "demiplane_socket_sink_test.sock";
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    [[nodiscard]] SocketSinkConfig::Builder unix_config() const {
+        return SocketSinkConfig::Builder{}.unix_socket(path.string()).reconnect_interval_ms(0);
+    }
+};
+
+TEST_F(SocketSinkTest, BatchArrivesAsOneDatagramPerEvent) {
+    const auto receiver = DatagramReceiver::unix_at(path);
+    SocketSink<DetailedEntry> sink{unix_config().framing(SocketSinkConfig::Framing::Raw).finalize()};
+
+    std::vector<LogEvent> batch;
+    for (int i = 0; i < 100; ++i) {
+        batch.push_back(make_event(LogLevel::Info, "event " + std::to_string(i)));
+    }
+    sink.process_batch(batch);
+
+    for (int i = 0; i < 100; ++i) {
+        const auto datagram = receiver.receive();
+        ASSERT_TRUE(datagram.has_value());
+        EXPECT_TRUE(datagram->ends_with("event " + std::to_string(i)));  // no trailing newline
+    }
+    EXPECT_EQ(sink.sent(), 100u);
+    EXPECT_EQ(sink.dropped(), 0u);
+}
+
+TEST_F(SocketSinkTest, Rfc5424Framing) {
+    const auto receiver = DatagramReceiver::unix_at(path);
+    SocketSink<DetailedEntry> sink{unix_config().facility(16).hostname("host").app_name("app").finalize()};
+
+    sink.process(make_event(LogLevel::Warning, "disk low", "Storage"));
+    sink.process(make_event(LogLevel::Info, "no prefix"));
+
+    const auto warning = receiver.receive();
+    ASSERT_TRUE(warning.has_value());
+    EXPECT_TRUE(warning->starts_with("<132>1 "));  // local0 (16) * 8 + warning (4)
+    EXPECT_NE(warning->find("Z host app "), std::string::npos);
+    EXPECT_TRUE(warning->ends_with(" Storage - disk low"));
+
+    const auto info = receiver.receive();
+    ASSERT_TRUE(info.has_value());
+    EXPECT_TRUE(info->starts_with("<134>1 "));
+    EXPECT_TRUE(info->ends_with(" - - no prefix"));
+}
+
+TEST_F(SocketSinkTest, UdpLoopback) {
+    const auto receiver = DatagramReceiver::udp_loopback();
+    SocketSink<DetailedEntry> sink{SocketSinkConfig::Builder{}.udp("127.0.0.1", receiver.port()).finalize()};
+
+    sink.process(make_event(LogLevel::Error, "over udp"));
+
+    const auto datagram = receiver.receive();
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_TRUE(datagram->starts_with("<11>1 "));  // user (1) * 8 + error (3)
+    EXPECT_TRUE(datagram->ends_with("over udp"));
+}
+
+TEST_F(SocketSinkTest, ConnectsOnceTheAgentAppears) {
+    std::filesystem::remove(path);
+    SocketSink<DetailedEntry> sink{unix_config().finalize()};
+
+    sink.process(make_event(LogLevel::Info, "lost"));
+    EXPECT_EQ(sink.dropped(), 1u);
+
+    const auto receiver = DatagramReceiver::unix_at(path);
+    sink.process(make_event(LogLevel::Info, "delivered"));
+
+    const auto datagram = receiver.receive();
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_TRUE(datagram->ends_with("delivered"));
+    EXPECT_EQ(sink.sent(), 1u);
+}
+
+TEST_F(SocketSinkTest, ReconnectsAfterAgentRestart) {
+    std::optional receiver{DatagramReceiver::unix_at(path)};
+    SocketSink<DetailedEntry> sink{unix_config().finalize()};
+    sink.process(make_event(LogLevel::Info, "before"));
+    ASSERT_TRUE(receiver->receive().has_value());
+
+    receiver.reset();
+    receiver.emplace(DatagramReceiver::unix_at(path));
+    sink.process(make_event(LogLevel::Info, "after"));
+
+    const auto datagram = receiver->receive();
+    ASSERT_TRUE(datagram.has_value());
+    EXPECT_TRUE(datagram->ends_with("after"));
+}
+
+TEST_F(SocketSinkTest, SlowAgentDropsInsteadOfBlocking) {
+    const auto receiver = DatagramReceiver::unix_at(path);  // never drained
+    SocketSink<DetailedEntry> sink{unix_config().finalize()};
+
+    constexpr std::size_t count = 20000;
+    std::vector<LogEvent> batch;
+    for (std::size_t i = 0; i < count; ++i) {
+        batch.push_back(make_event(LogLevel::Info, std::string(512, 'x')));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    sink.process_batch(batch);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+
+    EXPECT_GT(sink.dropped(), 0u);
+    EXPECT_EQ(sink.sent() + sink.dropped(), count);
+}
+
+TEST(SocketSinkConfigTest, Validation) {
+    EXPECT_THROW(std::ignore = SocketSinkConfig::Builder{}.unix_socket("").finalize(), std::invalid_argument);
+    EXPECT_THROW(std::ignore = SocketSinkConfig::Builder{}.udp("127.0.0.1", 0).finalize(), std::invalid_argument);
+    EXPECT_THROW(std::ignore = SocketSinkConfig::Builder{}.facility(24).finalize(), std::invalid_argument);
+    EXPECT_NO_THROW(std::ignore = SocketSinkConfig::Builder{}.finalize());
+}
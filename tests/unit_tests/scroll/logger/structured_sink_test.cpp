@@ -0,0 +1,152 @@
+#include <cmath>
+#include <demiplane/scroll>
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace demiplane::scroll;
+
+namespace {
+    LogEvent make_event(const std::string& message) {
+        LogEvent event;
+        event.level      = LogLevel::Info;
+        event.message    = message;
+        event.location   = detail::MetaSource{std::source_location::current()};
+        event.time_point = detail::MetaTimePoint{};
+        return event;
+    }
+
+    std::string encode_json(const LogEvent& event) {
+        std::string out;
+        JsonEncoder::encode(event, out);
+        return out;
+    }
+
+    std::string encode_logfmt(const LogEvent& event) {
+        std::string out;
+        LogfmtEncoder::encode(event, out);
+        return out;
+    }
+}  // namespace
+
+TEST(LogFieldsTest, KeepsValueTypes) {
+    LogFields fields;
+    fields.add("ok", true);
+    fields.add("delta", -5);
+    fields.add("count", 7u);
+    fields.add("ratio", 0.5);
+    fields.add("name", std::string{"alice"});
+    fields.add("grade", 'A');
+
+    ASSERT_EQ(fields.size(), 6u);
+    EXPECT_EQ(fields[0].key, "ok");
+    EXPECT_EQ(std::get<bool>(fields[0].value), true);
+    EXPECT_EQ(std::get<std::int64_t>(fields[1].value), -5);
+    EXPECT_EQ(std::get<std::uint64_t>(fields[2].value), 7u);
+    EXPECT_EQ(std::get<double>(fields[3].value), 0.5);
+    EXPECT_EQ(std::get<std::string_view>(fields[4].value), "alice");
+    EXPECT_EQ(std::get<std::string_view>(fields[5].value), "A");
+}
+
+TEST(LogFieldsTest, SpillsPastInlineCapacityAndSurvivesCopy) {
+    LogFields fields;
+    for (std::size_t i = 0; i < LogFields::inline_capacity * 2; ++i) {
+        fields.add("k" + std::to_string(i), i);
+    }
+
+    const LogFields copy = fields;
+    fields.clear();
+    EXPECT_TRUE(fields.empty());
+
+    ASSERT_EQ(copy.size(), LogFields::inline_capacity * 2);
+    for (std::size_t i = 0; i < copy.size(); ++i) {
+        EXPECT_EQ(copy[i].key, "k" + std::to_string(i));
+        EXPECT_EQ(std::get<std::uint64_t>(copy[i].value), i);
+    }
+}
+
+TEST(StructuredEncoderTest, JsonWritesFieldsWithTheirTypes) {
+    auto event = make_event("query done");
+    event.fields.add("rows", 17);
+    event.fields.add("cached", false);
+    event.fields.add("table", std::string_view{"users"});
+    event.fields.add("load", std::numeric_limits<double>::quiet_NaN());
+
+    const auto line = encode_json(event);
+    EXPECT_EQ(line.front(), '{');
+    EXPECT_EQ(line.substr(line.size() - 2), "}\n");
+    EXPECT_NE(line.find(R"("level":"INF")"), std::string::npos);
+    EXPECT_NE(line.find(R"("msg":"query done")"), std::string::npos);
+    EXPECT_NE(line.find(R"("src":"structured_sink_test.cpp:)"), std::string::npos);
+    EXPECT_NE(line.find(R"("rows":17,"cached":false,"table":"users","load":null})"), std::string::npos);
+    EXPECT_EQ(line.find("prefix"), std::string::npos);
+}
+
+TEST(StructuredEncoderTest, JsonEscapesStrings) {
+    auto event = make_event("say \"hi\"\n\\ \x01");
+    event.prefix.assign("Db");
+
+    const auto line = encode_json(event);
+    EXPECT_NE(line.find(R"("prefix":"Db")"), std::string::npos);
+    EXPECT_NE(line.find(R"("msg":"say \"hi\"\n\\ \u0001")"), std::string::npos);
+}
+
+TEST(StructuredEncoderTest, LogfmtQuotesOnlyWhenNeeded) {
+    auto event = make_event("query done");
+    event.fields.add("rows", -3);
+    event.fields.add("table", std::string_view{"users"});
+    event.fields.add("filter", std::string_view{"a=b"});
+    event.fields.add("empty", std::string_view{});
+
+    const auto line = encode_logfmt(event);
+    EXPECT_EQ(line.substr(0, 3), "ts=");
+    EXPECT_EQ(line.back(), '\n');
+    EXPECT_NE(line.find(" level=INF "), std::string::npos);
+    EXPECT_NE(line.find(R"( msg="query done" rows=-3 table=users filter="a=b" empty=""
+)"),
+              std::string::npos);
+}
+
+TEST(StructuredSinkTest, LoggerCarriesFieldsToJsonSink) {
+    std::ostringstream output;
+    auto sink = std::make_shared<JsonSink>(StructuredSinkConfig::Builder{}.output(&output).finalize());
+    {
+        Logger logger{LoggerConfig::Builder{}.finalize()};
+        logger.add_sink(sink);
+
+        const int user_id     = 42;
+        const double latency  = 1.5;
+        const std::string who = "bob";
+        logger.stream(INF, "Http") << "served" << SCROLL_FIELDS(user_id, latency);
+        logger.stream(INF, "Http").field("who", who) << "second";
+        logger.stream(INF, "Http") << "plain";
+        logger.shutdown();
+    }
+
+    std::istringstream lines{output.str()};
+    std::string first, second, third;
+    ASSERT_TRUE(std::getline(lines, first));
+    ASSERT_TRUE(std::getline(lines, second));
+    ASSERT_TRUE(std::getline(lines, third));
+
+    EXPECT_NE(first.find(R"("msg":"served","user_id":42,"latency":1.5})"), std::string::npos);
+    EXPECT_NE(second.find(R"("msg":"second","who":"bob"})"), std::string::npos);
+    // A reused ring slot must not leak the previous event's fields
+    EXPECT_NE(third.find(R"("msg":"plain"})"), std::string::npos);
+}
+
+TEST(StructuredSinkTest, ThresholdFiltersEvents) {
+    std::ostringstream output;
+    LogfmtSink sink{StructuredSinkConfig::Builder{}.output(&output).threshold(LogLevel::Warning).finalize()};
+
+    auto warning  = make_event("loud");
+    warning.level = LogLevel::Warning;
+
+    const LogEvent batch[] = {make_event("quiet"), warning};
+    sink.process_batch(batch);
+
+    EXPECT_EQ(output.str().find("quiet"), std::string::npos);
+    EXPECT_NE(output.str().find("msg=loud"), std::string::npos);
+}